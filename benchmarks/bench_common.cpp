@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <utility>
+
+#include <loco/core/common.hpp>
+
+namespace {
+/// Creates a mesh with the given number of vertices and faces (dummy data)
+auto CreateMeshData(size_t num_vertices, size_t num_faces) -> ::loco::MeshData {
+    ::loco::MeshData mesh_data;
+    mesh_data.n_vertices = num_vertices;
+    mesh_data.n_faces = num_faces;
+    mesh_data.vertices = ::loco::SharedBuffer<Scalar>(3 * num_vertices);
+    mesh_data.faces = ::loco::SharedBuffer<uint32_t>(3 * num_faces);
+    auto* vertices = mesh_data.vertices.mutable_data();
+    auto* faces = mesh_data.faces.mutable_data();
+    for (size_t i = 0; i < 3 * num_vertices; ++i) {
+        vertices[i] = static_cast<Scalar>(i);
+    }
+    for (size_t i = 0; i < 3 * num_faces; ++i) {
+        faces[i] = static_cast<uint32_t>(i % num_vertices);
+    }
+    return mesh_data;
+}
+
+/// Creates a square heightfield with the given number of samples per side
+auto CreateHeightfieldData(size_t num_samples) -> ::loco::HeightfieldData {
+    ::loco::HeightfieldData hfield_data;
+    hfield_data.n_width_samples = num_samples;
+    hfield_data.n_depth_samples = num_samples;
+    hfield_data.heights =
+        ::loco::SharedBuffer<Scalar>(num_samples * num_samples);
+    auto* heights = hfield_data.heights.mutable_data();
+    for (size_t i = 0; i < num_samples * num_samples; ++i) {
+        heights[i] = ToScalar(0.01) * static_cast<Scalar>(i % 100);
+    }
+    return hfield_data;
+}
+
+// Copy of a mesh (buffers are shared), with range(0) vertices and 2x faces
+auto BM_MeshDataCopy(benchmark::State& state) -> void {
+    const auto NUM_VERTICES = static_cast<size_t>(state.range(0));
+    auto mesh_data = CreateMeshData(NUM_VERTICES, 2 * NUM_VERTICES);
+    for (auto _ : state) {
+        ::loco::MeshData copy(mesh_data);
+        benchmark::DoNotOptimize(copy.vertices.get());
+        benchmark::ClobberMemory();
+    }
+}
+
+// Copy of a mesh followed by a write into its vertices (deep copy of those)
+auto BM_MeshDataCopyOnWrite(benchmark::State& state) -> void {
+    const auto NUM_VERTICES = static_cast<size_t>(state.range(0));
+    auto mesh_data = CreateMeshData(NUM_VERTICES, 2 * NUM_VERTICES);
+    for (auto _ : state) {
+        ::loco::MeshData copy(mesh_data);
+        copy.vertices.mutable_data()[0] = ToScalar(1.0);
+        benchmark::DoNotOptimize(copy.vertices.get());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(3 * NUM_VERTICES *
+                                                 sizeof(Scalar)));
+}
+
+// Move of a mesh back and forth between two objects (should be O(1))
+auto BM_MeshDataMove(benchmark::State& state) -> void {
+    const auto NUM_VERTICES = static_cast<size_t>(state.range(0));
+    auto mesh_data = CreateMeshData(NUM_VERTICES, 2 * NUM_VERTICES);
+    for (auto _ : state) {
+        ::loco::MeshData moved(std::move(mesh_data));
+        mesh_data = std::move(moved);
+        benchmark::DoNotOptimize(mesh_data.vertices.get());
+    }
+}
+
+// Copy of a square heightfield (buffer is shared), range(0) samples per side
+auto BM_HeightfieldDataCopy(benchmark::State& state) -> void {
+    const auto NUM_SAMPLES = static_cast<size_t>(state.range(0));
+    auto hfield_data = CreateHeightfieldData(NUM_SAMPLES);
+    for (auto _ : state) {
+        ::loco::HeightfieldData copy(hfield_data);
+        benchmark::DoNotOptimize(copy.heights.get());
+        benchmark::ClobberMemory();
+    }
+}
+
+// Move of a heightfield back and forth between two objects
+auto BM_HeightfieldDataMove(benchmark::State& state) -> void {
+    const auto NUM_SAMPLES = static_cast<size_t>(state.range(0));
+    auto hfield_data = CreateHeightfieldData(NUM_SAMPLES);
+    for (auto _ : state) {
+        ::loco::HeightfieldData moved(std::move(hfield_data));
+        hfield_data = std::move(moved);
+        benchmark::DoNotOptimize(hfield_data.heights.get());
+    }
+}
+}  // namespace
+
+// NOLINTNEXTLINE
+BENCHMARK(BM_MeshDataCopy)->RangeMultiplier(8)->Range(64, 1 << 18);
+// NOLINTNEXTLINE
+BENCHMARK(BM_MeshDataCopyOnWrite)->RangeMultiplier(8)->Range(64, 1 << 18);
+// NOLINTNEXTLINE
+BENCHMARK(BM_MeshDataMove)->Arg(1 << 12);
+// NOLINTNEXTLINE
+BENCHMARK(BM_HeightfieldDataCopy)->RangeMultiplier(4)->Range(16, 1024);
+// NOLINTNEXTLINE
+BENCHMARK(BM_HeightfieldDataMove)->Arg(256);
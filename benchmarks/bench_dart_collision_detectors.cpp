@@ -0,0 +1,150 @@
+#include <benchmark/benchmark.h>
+
+#if defined(LOCO_DART_ENABLED)
+
+// Disable warnings generated by the DART codebase
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wsign-conversion"
+#pragma clang diagnostic ignored "-Wold-style-cast"
+#pragma clang diagnostic ignored "-Wdouble-promotion"
+#pragma clang diagnostic ignored "-Wimplicit-float-conversion"
+#pragma clang diagnostic ignored "-Wcast-align"
+#endif
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <loco/backends/dart/simulation_impl_dart.hpp>
+#include <loco/core/scenario_t.hpp>
+#include <loco/core/simulation_t.hpp>
+
+namespace {
+constexpr double BODY_SIZE = 0.2;
+constexpr double TIMESTEP = 0.001;
+constexpr double STEP = 1.0 / 60.0;
+/// Number of bodies dropped onto the ground
+constexpr size_t NUM_BODIES = 500;
+/// Number of steps taken before measuring, so the pile is already in contact
+constexpr size_t NUM_WARMUP_STEPS = 30;
+
+/// Creates a static box used as the ground
+auto CreateGround() -> ::dart::dynamics::SkeletonPtr {
+    auto skeleton = ::dart::dynamics::Skeleton::create("ground");
+    auto pair =
+        skeleton->createJointAndBodyNodePair<::dart::dynamics::WeldJoint>();
+    auto shape = std::make_shared<::dart::dynamics::BoxShape>(
+        Eigen::Vector3d(20.0, 20.0, 0.2));
+    pair.second->createShapeNodeWith<::dart::dynamics::CollisionAspect,
+                                     ::dart::dynamics::DynamicsAspect>(shape);
+    Eigen::Isometry3d tf = Eigen::Isometry3d::Identity();
+    tf.translation() = Eigen::Vector3d(0.0, 0.0, -0.1);
+    pair.first->setTransformFromParentBodyNode(tf);
+    return skeleton;
+}
+
+/// Creates the given body of the pile (boxes and spheres, alternating)
+auto CreateBody(size_t index) -> ::dart::dynamics::SkeletonPtr {
+    auto skeleton =
+        ::dart::dynamics::Skeleton::create("body_" + std::to_string(index));
+    auto pair =
+        skeleton->createJointAndBodyNodePair<::dart::dynamics::FreeJoint>();
+
+    ::dart::dynamics::ShapePtr shape = nullptr;
+    if (index % 2 == 0) {
+        shape = std::make_shared<::dart::dynamics::BoxShape>(
+            Eigen::Vector3d::Constant(BODY_SIZE));
+    } else {
+        shape =
+            std::make_shared<::dart::dynamics::SphereShape>(0.5 * BODY_SIZE);
+    }
+    pair.second->createShapeNodeWith<::dart::dynamics::CollisionAspect,
+                                     ::dart::dynamics::DynamicsAspect>(shape);
+
+    ::dart::dynamics::Inertia inertia;
+    inertia.setMass(1.0);
+    inertia.setMoment(shape->computeInertia(1.0));
+    pair.second->setInertia(inertia);
+
+    // Stack the bodies in a 10x10 grid of columns, slightly offset per layer
+    constexpr size_t GRID = 10;
+    const auto LAYER = static_cast<double>(index / (GRID * GRID));
+    const auto ROW = static_cast<double>((index / GRID) % GRID);
+    const auto COL = static_cast<double>(index % GRID);
+    Eigen::Isometry3d tf = Eigen::Isometry3d::Identity();
+    tf.translation() = Eigen::Vector3d(
+        1.1 * BODY_SIZE * COL + 0.01 * LAYER,
+        1.1 * BODY_SIZE * ROW - 0.01 * LAYER, BODY_SIZE * (1.5 * LAYER + 1.0));
+    skeleton->setPositions(
+        ::dart::dynamics::FreeJoint::convertToPositions(tf));
+    return skeleton;
+}
+
+// Throughput of the given collision detector of the DART backend, stepping a
+// pile of boxes and spheres dropped onto the ground. The DART backend doesn't
+// build worlds from scenarios yet, so the pile is added to its world directly
+auto BM_DartCollisionDetector(benchmark::State& state,
+                              ::loco::eCollisionDetectorType detector)
+    -> void {
+    ::loco::SimulationConfig config;
+    config.collision_detector = detector;
+    config.fixed_substeps = true;
+
+    auto scenario = std::make_shared<::loco::core::Scenario>();
+    ::loco::core::Simulation simulation(scenario, ::loco::eBackendType::DART,
+                                        config);
+    try {
+        simulation.Init();
+    } catch (const std::exception& e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    simulation.SetTimeStep(ToScalar(TIMESTEP));
+
+    auto& impl =
+        dynamic_cast<::loco::dart::SimulationImplDart&>(simulation.impl());
+    auto& world = impl.dart_world();
+    world.addSkeleton(CreateGround());
+    for (size_t i = 0; i < NUM_BODIES; ++i) {
+        world.addSkeleton(CreateBody(i));
+    }
+    for (size_t i = 0; i < NUM_WARMUP_STEPS; ++i) {
+        simulation.Step(ToScalar(STEP));
+    }
+
+    for (auto _ : state) {
+        simulation.Step(ToScalar(STEP));
+    }
+
+    const auto NUM_SUBSTEPS = static_cast<double>(
+        state.iterations() * impl.num_substeps(ToScalar(STEP)));
+    state.counters["substeps_per_second"] =
+        benchmark::Counter(NUM_SUBSTEPS, benchmark::Counter::kIsRate);
+    state.counters["num_contacts"] = benchmark::Counter(
+        static_cast<double>(simulation.stats().num_contacts));
+}
+}  // namespace
+
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_DartCollisionDetector, fcl,
+                  ::loco::eCollisionDetectorType::FCL)
+    ->Unit(benchmark::kMillisecond);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_DartCollisionDetector, ode,
+                  ::loco::eCollisionDetectorType::ODE)
+    ->Unit(benchmark::kMillisecond);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_DartCollisionDetector, bullet,
+                  ::loco::eCollisionDetectorType::BULLET)
+    ->Unit(benchmark::kMillisecond);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_DartCollisionDetector, dart,
+                  ::loco::eCollisionDetectorType::DART)
+    ->Unit(benchmark::kMillisecond);
+
+#if defined(__clang__)
+#pragma clang diagnostic pop  // NOLINT
+#endif
+
+#endif  // LOCO_DART_ENABLED
@@ -0,0 +1,46 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+#include <loco/core/memory_pool_t.hpp>
+#include <loco/core/visualizer/drawable_primitives.hpp>
+
+namespace {
+// Creation and release of range(0) boxes through the default heap allocator
+auto BM_DrawableCreateHeap(benchmark::State& state) -> void {
+    const auto NUM_DRAWABLES = static_cast<size_t>(state.range(0));
+    std::vector<::loco::core::viz::Box::ptr> boxes;
+    boxes.reserve(NUM_DRAWABLES);
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_DRAWABLES; ++i) {
+            boxes.push_back(std::make_shared<::loco::core::viz::Box>(
+                "marker", Vec3(0.0, 0.0, 1.0), Vec3(0.1, 0.1, 0.1)));
+        }
+        boxes.clear();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+// Creation and release of range(0) boxes through the small-object pools
+auto BM_DrawableCreatePooled(benchmark::State& state) -> void {
+    const auto NUM_DRAWABLES = static_cast<size_t>(state.range(0));
+    std::vector<::loco::core::viz::Box::ptr> boxes;
+    boxes.reserve(NUM_DRAWABLES);
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_DRAWABLES; ++i) {
+            boxes.push_back(::loco::core::MakePooled<::loco::core::viz::Box>(
+                "marker", Vec3(0.0, 0.0, 1.0), Vec3(0.1, 0.1, 0.1)));
+        }
+        boxes.clear();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            state.range(0));
+}
+}  // namespace
+
+// NOLINTNEXTLINE
+BENCHMARK(BM_DrawableCreateHeap)->Arg(10000);
+// NOLINTNEXTLINE
+BENCHMARK(BM_DrawableCreatePooled)->Arg(10000);
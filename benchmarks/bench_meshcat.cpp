@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#if defined(LOCO_VISUALIZER_MESHCAT_ENABLED)
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <loco/visualizers/meshcat/drawable_impl_meshcat.hpp>
+
+namespace {
+/// Returns the meshcat server shared by all benchmarks (starting it is slow)
+auto GetMeshcatHandle() -> std::shared_ptr<MeshcatCpp::Meshcat> {
+    static auto s_Handle = std::make_shared<MeshcatCpp::Meshcat>();
+    return s_Handle;
+}
+
+// Sends the pose of range(0) box drawables to meshcat, once per iteration
+auto BM_MeshcatSetPose(benchmark::State& state) -> void {
+    const auto NUM_DRAWABLES = static_cast<size_t>(state.range(0));
+    auto handle = GetMeshcatHandle();
+
+    ::loco::DrawableData data;
+    data.type = ::loco::eShapeType::BOX;
+    data.size = {ToScalar(0.2), ToScalar(0.2), ToScalar(0.2)};
+
+    std::vector<std::unique_ptr<::loco::meshcat::DrawableImplMeshcat>>
+        drawables;
+    drawables.reserve(NUM_DRAWABLES);
+    for (size_t i = 0; i < NUM_DRAWABLES; ++i) {
+        drawables.push_back(
+            std::make_unique<::loco::meshcat::DrawableImplMeshcat>(
+                "bench_box_" + std::to_string(i), data, handle));
+    }
+
+    Pose pose;
+    Scalar height = ToScalar(0.0);
+    for (auto _ : state) {
+        height += ToScalar(0.001);
+        pose.position = {ToScalar(0.0), ToScalar(0.0), height};
+        for (auto& drawable : drawables) {
+            drawable->SetPose(pose);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(NUM_DRAWABLES));
+}
+
+// Same as above, but collecting the poses in a batch flushed once per frame
+auto BM_MeshcatSetPoseBatched(benchmark::State& state) -> void {
+    const auto NUM_DRAWABLES = static_cast<size_t>(state.range(0));
+    auto handle = GetMeshcatHandle();
+    auto pose_batch = std::make_shared<::loco::meshcat::PoseBatchMeshcat>();
+
+    ::loco::DrawableData data;
+    data.type = ::loco::eShapeType::BOX;
+    data.size = {ToScalar(0.2), ToScalar(0.2), ToScalar(0.2)};
+
+    std::vector<std::unique_ptr<::loco::meshcat::DrawableImplMeshcat>>
+        drawables;
+    drawables.reserve(NUM_DRAWABLES);
+    for (size_t i = 0; i < NUM_DRAWABLES; ++i) {
+        drawables.push_back(
+            std::make_unique<::loco::meshcat::DrawableImplMeshcat>(
+                "bench_box_" + std::to_string(i), data, handle, pose_batch));
+    }
+
+    Pose pose;
+    Scalar height = ToScalar(0.0);
+    for (auto _ : state) {
+        height += ToScalar(0.001);
+        pose.position = {ToScalar(0.0), ToScalar(0.0), height};
+        for (auto& drawable : drawables) {
+            drawable->SetPose(pose);
+        }
+        pose_batch->Flush(*handle);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(NUM_DRAWABLES));
+}
+}  // namespace
+
+// NOLINTNEXTLINE
+BENCHMARK(BM_MeshcatSetPose)->Arg(1)->Arg(64)->Arg(512);
+// NOLINTNEXTLINE
+BENCHMARK(BM_MeshcatSetPoseBatched)->Arg(1)->Arg(64)->Arg(512);
+
+#endif  // LOCO_VISUALIZER_MESHCAT_ENABLED
@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <loco/core/scenario_t.hpp>
+#include <loco/core/visualizer/drawable_primitives.hpp>
+
+namespace {
+/// Creates a scenario populated with the given number of box drawables
+auto CreateScenario(size_t num_drawables) -> ::loco::core::Scenario::ptr {
+    auto scenario = std::make_shared<::loco::core::Scenario>();
+    for (size_t i = 0; i < num_drawables; ++i) {
+        scenario->AddDrawable(std::make_shared<::loco::core::viz::Box>(
+            "box_" + std::to_string(i), Vec3(0.0, 0.0, 1.0),
+            Vec3(0.2, 0.2, 0.2)));
+    }
+    return scenario;
+}
+
+// Lookup of drawables by name, in a scenario with range(0) drawables
+auto BM_ScenarioGetDrawableByName(benchmark::State& state) -> void {
+    const auto NUM_DRAWABLES = static_cast<size_t>(state.range(0));
+    auto scenario = CreateScenario(NUM_DRAWABLES);
+
+    std::vector<std::string> names;
+    names.reserve(NUM_DRAWABLES);
+    for (size_t i = 0; i < NUM_DRAWABLES; ++i) {
+        names.push_back("box_" + std::to_string(i));
+    }
+
+    size_t index = 0;
+    for (auto _ : state) {
+        auto drawable = scenario->GetDrawableByName(names[index]);
+        benchmark::DoNotOptimize(drawable.get());
+        index = (index + 1) % NUM_DRAWABLES;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+// Lookup of a name that isn't in the scenario (the miss path)
+auto BM_ScenarioGetDrawableByNameMiss(benchmark::State& state) -> void {
+    auto scenario = CreateScenario(static_cast<size_t>(state.range(0)));
+    const std::string name = "not_a_drawable";
+    for (auto _ : state) {
+        auto drawable = scenario->GetDrawableByName(name);
+        benchmark::DoNotOptimize(drawable.get());
+    }
+}
+
+// Lookup of drawables by handle (no hashing nor reference counting)
+auto BM_ScenarioGetDrawableByHandle(benchmark::State& state) -> void {
+    const auto NUM_DRAWABLES = static_cast<size_t>(state.range(0));
+    auto scenario = CreateScenario(NUM_DRAWABLES);
+
+    std::vector<::loco::core::DrawableHandle> handles;
+    handles.reserve(NUM_DRAWABLES);
+    for (size_t i = 0; i < NUM_DRAWABLES; ++i) {
+        handles.push_back(scenario->FindDrawable("box_" + std::to_string(i)));
+    }
+
+    size_t index = 0;
+    for (auto _ : state) {
+        auto* drawable = scenario->GetDrawable(handles[index]);
+        benchmark::DoNotOptimize(drawable);
+        index = (index + 1) % NUM_DRAWABLES;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+// Lookup of drawables by index, as a baseline for the lookups by name
+auto BM_ScenarioGetDrawableByIndex(benchmark::State& state) -> void {
+    const auto NUM_DRAWABLES = static_cast<size_t>(state.range(0));
+    auto scenario = CreateScenario(NUM_DRAWABLES);
+    size_t index = 0;
+    for (auto _ : state) {
+        auto drawable = scenario->GetDrawableByIndex(index);
+        benchmark::DoNotOptimize(drawable.get());
+        index = (index + 1) % NUM_DRAWABLES;
+    }
+}
+
+// Removal and re-addition of a drawable, in a scenario with range(0) of them
+auto BM_ScenarioRemoveAddDrawable(benchmark::State& state) -> void {
+    const auto NUM_DRAWABLES = static_cast<size_t>(state.range(0));
+    auto scenario = CreateScenario(NUM_DRAWABLES);
+    auto handle = scenario->FindDrawable("box_0");
+    for (auto _ : state) {
+        auto drawable = scenario->RemoveDrawable(handle);
+        handle = scenario->AddDrawable(std::move(drawable));
+        benchmark::DoNotOptimize(handle);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+}  // namespace
+
+// NOLINTNEXTLINE
+BENCHMARK(BM_ScenarioGetDrawableByName)->RangeMultiplier(4)->Range(16, 1024);
+// NOLINTNEXTLINE
+BENCHMARK(BM_ScenarioGetDrawableByNameMiss)->Arg(1024);
+// NOLINTNEXTLINE
+BENCHMARK(BM_ScenarioGetDrawableByHandle)->RangeMultiplier(4)->Range(16, 1024);
+// NOLINTNEXTLINE
+BENCHMARK(BM_ScenarioGetDrawableByIndex)->Arg(1024);
+// NOLINTNEXTLINE
+BENCHMARK(BM_ScenarioRemoveAddDrawable)->Arg(1024)->Arg(16384);
@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <stdexcept>
+
+#include <loco/core/scenario_t.hpp>
+#include <loco/core/simulation_t.hpp>
+
+namespace {
+constexpr double TIMESTEP = 0.002;
+constexpr double STEP = 1.0 / 60.0;
+
+// Measures the cost of a single Simulation::Step with the given backend. The
+// backends don't build worlds from scenarios yet, so this is mostly the
+// per-step overhead of the frontend (dispatch, stats, substep bookkeeping)
+auto BM_SimulationStep(benchmark::State& state, ::loco::eBackendType backend,
+                       bool fixed_substeps) -> void {
+    ::loco::SimulationConfig config;
+    config.fixed_substeps = fixed_substeps;
+
+    auto scenario = std::make_shared<::loco::core::Scenario>();
+    ::loco::core::Simulation simulation(scenario, backend, config);
+    try {
+        simulation.Init();
+    } catch (const std::exception& e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    simulation.SetTimeStep(ToScalar(TIMESTEP));
+
+    for (auto _ : state) {
+        simulation.Step(ToScalar(STEP));
+    }
+
+    const auto& stats = simulation.stats();
+    state.counters["substeps_per_step"] =
+        benchmark::Counter(static_cast<double>(stats.num_substeps) /
+                           static_cast<double>(stats.num_steps));
+    state.counters["steps_per_second"] = benchmark::Counter(
+        static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+// Measures the round-trip of an asynchronous step (launch, then wait)
+auto BM_SimulationStepAsync(benchmark::State& state,
+                            ::loco::eBackendType backend) -> void {
+    auto scenario = std::make_shared<::loco::core::Scenario>();
+    ::loco::core::Simulation simulation(scenario, backend);
+    try {
+        simulation.Init();
+    } catch (const std::exception& e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+    simulation.SetTimeStep(ToScalar(TIMESTEP));
+
+    for (auto _ : state) {
+        auto handle = simulation.StepAsync(ToScalar(STEP));
+        handle.wait();
+    }
+}
+}  // namespace
+
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_SimulationStep, none, ::loco::eBackendType::NONE, false);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_SimulationStepAsync, none, ::loco::eBackendType::NONE);
+
+#if defined(LOCO_MUJOCO_ENABLED)
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_SimulationStep, mujoco, ::loco::eBackendType::MUJOCO,
+                  false);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_SimulationStep, mujoco_fixed_substeps,
+                  ::loco::eBackendType::MUJOCO, true);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_SimulationStepAsync, mujoco, ::loco::eBackendType::MUJOCO);
+#endif  // LOCO_MUJOCO_ENABLED
+
+#if defined(LOCO_BULLET_ENABLED)
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_SimulationStep, bullet, ::loco::eBackendType::BULLET,
+                  false);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_SimulationStep, bullet_fixed_substeps,
+                  ::loco::eBackendType::BULLET, true);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_SimulationStepAsync, bullet, ::loco::eBackendType::BULLET);
+#endif  // LOCO_BULLET_ENABLED
+
+#if defined(LOCO_DART_ENABLED)
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_SimulationStep, dart, ::loco::eBackendType::DART, false);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_SimulationStep, dart_fixed_substeps,
+                  ::loco::eBackendType::DART, true);
+// NOLINTNEXTLINE
+BENCHMARK_CAPTURE(BM_SimulationStepAsync, dart, ::loco::eBackendType::DART);
+#endif  // LOCO_DART_ENABLED
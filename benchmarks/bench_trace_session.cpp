@@ -0,0 +1,29 @@
+#include <benchmark/benchmark.h>
+
+#include <loco/core/trace_session_t.hpp>
+
+namespace {
+// Cost of a scope while no session is active (should be close to zero)
+auto BM_TraceScopeInactive(benchmark::State& state) -> void {
+    ::loco::core::TraceSession::End();
+    for (auto _ : state) {
+        ::loco::core::TraceScope scope("bench_scope");
+        benchmark::ClobberMemory();
+    }
+}
+
+// Cost of a scope recorded into the ring buffer of the calling thread
+auto BM_TraceScopeActive(benchmark::State& state) -> void {
+    ::loco::core::TraceSession::Begin();
+    for (auto _ : state) {
+        ::loco::core::TraceScope scope("bench_scope");
+        benchmark::ClobberMemory();
+    }
+    ::loco::core::TraceSession::End();
+}
+}  // namespace
+
+// NOLINTNEXTLINE
+BENCHMARK(BM_TraceScopeInactive);
+// NOLINTNEXTLINE
+BENCHMARK(BM_TraceScopeActive);
@@ -0,0 +1,167 @@
+"""Benchmarks for the round-trips through the Python bindings.
+
+The report follows the JSON layout of Google Benchmark (the one used by the
+LocoBenchmarks target), so both reports can be tracked by the same dashboards.
+
+usage: python bench_bindings.py [--out report.json] [--min-time 0.5]
+"""
+
+import argparse
+import datetime
+import json
+import os
+import platform
+import time
+from typing import Callable, Dict, List
+
+import numpy as np
+
+import loco
+
+
+def run_benchmark(
+    name: str, fn: Callable[[], None], min_time: float
+) -> Dict[str, object]:
+    """Runs fn repeatedly for at least min_time seconds, Google Benchmark-like.
+
+    The number of iterations is grown geometrically until a batch takes at
+    least min_time, and only the timings of that last batch are reported.
+    """
+    iterations = 1
+    while True:
+        start_wall, start_cpu = time.perf_counter(), time.process_time()
+        for _ in range(iterations):
+            fn()
+        wall = time.perf_counter() - start_wall
+        cpu = time.process_time() - start_cpu
+        if wall >= min_time or iterations >= 1_000_000_000:
+            break
+        scale = 10.0 if wall <= 0.0 else min(10.0, 1.4 * min_time / wall)
+        iterations = max(iterations + 1, int(iterations * scale))
+
+    return {
+        "name": name,
+        "run_name": name,
+        "run_type": "iteration",
+        "repetitions": 1,
+        "repetition_index": 0,
+        "threads": 1,
+        "iterations": iterations,
+        "real_time": wall * 1e9 / iterations,
+        "cpu_time": cpu * 1e9 / iterations,
+        "time_unit": "ns",
+    }
+
+
+def make_benchmarks() -> Dict[str, Callable[[], None]]:
+    benchmarks: Dict[str, Callable[[], None]] = {}
+
+    # MeshData: numpy -> C++ (copy into a new SharedBuffer) and C++ -> numpy
+    for num_vertices in (64, 4096, 262144):
+        vertices = np.random.randn(num_vertices, 3).astype(np.float32)
+        mesh_data = loco.MeshData()
+        mesh_data.vertices = vertices
+
+        def set_vertices(md=mesh_data, v=vertices) -> None:
+            md.vertices = v
+
+        def get_vertices(md=mesh_data) -> None:
+            _ = md.vertices
+
+        benchmarks[f"PY_MeshDataSetVertices/{num_vertices}"] = set_vertices
+        benchmarks[f"PY_MeshDataGetVertices/{num_vertices}"] = get_vertices
+
+    # HeightfieldData: numpy -> C++ and C++ -> numpy
+    for num_samples in (16, 128, 1024):
+        heights = np.random.rand(num_samples, num_samples).astype(np.float32)
+        hfield_data = loco.HeightfieldData()
+        hfield_data.heights = heights
+
+        def set_heights(hd=hfield_data, h=heights) -> None:
+            hd.heights = h
+
+        def get_heights(hd=hfield_data) -> None:
+            _ = hd.heights
+
+        benchmarks[f"PY_HeightfieldDataSetHeights/{num_samples}"] = set_heights
+        benchmarks[f"PY_HeightfieldDataGetHeights/{num_samples}"] = get_heights
+
+    # Drawable: small-object round-trips (math3d values by value)
+    drawable_data = loco.DrawableData()
+    drawable_data.type = loco.ShapeType.BOX
+    pose = loco.ShapeData().local_tf
+    drawable = loco.Drawable("box", pose, drawable_data)
+
+    def set_pose() -> None:
+        drawable.pose = pose
+
+    def get_pose() -> None:
+        _ = drawable.pose
+
+    def set_position() -> None:
+        drawable.position = pose.position
+
+    benchmarks["PY_DrawableSetPose"] = set_pose
+    benchmarks["PY_DrawableGetPose"] = get_pose
+    benchmarks["PY_DrawableSetPosition"] = set_position
+
+    # Simulation: only when the (optional) simulation bindings are built
+    if hasattr(loco, "Simulation") and hasattr(loco, "Scenario"):
+        simulation = loco.Simulation(loco.Scenario(), loco.BackendType.NONE)
+        simulation.Init()
+
+        def step() -> None:
+            simulation.Step(1.0 / 60.0)
+
+        benchmarks["PY_SimulationStep/none"] = step
+
+    return benchmarks
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument(
+        "--out", type=str, default="", help="Path of the JSON report"
+    )
+    parser.add_argument(
+        "--min-time",
+        type=float,
+        default=0.5,
+        help="Minimum time (in seconds) spent on each benchmark",
+    )
+    parser.add_argument(
+        "--filter", type=str, default="", help="Only run names with this text"
+    )
+    args = parser.parse_args()
+
+    results: List[Dict[str, object]] = []
+    for name, fn in make_benchmarks().items():
+        if args.filter and args.filter not in name:
+            continue
+        result = run_benchmark(name, fn, args.min_time)
+        print(
+            f"{name:<40} {result['real_time']:>12.1f} ns "
+            f"{result['cpu_time']:>12.1f} ns {result['iterations']:>12}"
+        )
+        results.append(result)
+
+    report = {
+        "context": {
+            "date": datetime.datetime.now().isoformat(),
+            "host_name": platform.node(),
+            "executable": "bench_bindings.py",
+            "num_cpus": os.cpu_count(),
+            "python_version": platform.python_version(),
+            "numpy_version": np.__version__,
+            "library_build_type": "release",
+        },
+        "benchmarks": results,
+    }
+    if args.out:
+        with open(args.out, "w") as fhandle:
+            json.dump(report, fhandle, indent=2)
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
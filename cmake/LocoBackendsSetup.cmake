@@ -12,6 +12,7 @@ if(LOCO_BUILD_BACKEND_MUJOCO)
   target_sources(
     LocoCoreCpp
     PRIVATE ${SOURCE_DIR}/backends/mujoco/common_mujoco.cpp
+            ${SOURCE_DIR}/backends/mujoco/data_pool_mujoco.cpp
             ${SOURCE_DIR}/backends/mujoco/simulation_impl_mujoco.cpp)
   target_link_libraries(LocoCoreCpp PUBLIC mujoco::mujoco)
 endif()
@@ -24,6 +24,12 @@ if(LOCO_BUILD_BACKEND_BULLET)
   target_compile_definitions(LocoCoreCpp PUBLIC -DLOCO_BULLET_ENABLED)
   # Hint that Bullet was compiled using double precision
   target_compile_definitions(LocoCoreCpp PUBLIC -DBT_USE_DOUBLE_PRECISION)
+  if(LOCO_BUILD_BULLET_MULTITHREADING)
+    # Bullet's headers must see the same thread-safety setting as its sources
+    target_compile_definitions(LocoCoreCpp PUBLIC -DBT_THREADSAFE=1)
+    target_compile_definitions(LocoCoreCpp
+                               PUBLIC -DLOCO_BULLET_MULTITHREADING_ENABLED)
+  endif()
 endif()
 
 if(LOCO_BUILD_BACKEND_DART)
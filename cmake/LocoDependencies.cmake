@@ -8,8 +8,10 @@ include_guard()
 # * tinyxml2
 # * pybind11
 # * catch2
+# * benchmark
 # * utils
 # * math
+# * threads
 #
 # - Based on the superbuild script by jeffamstutz for ospray
 #   https://github.com/jeffamstutz/superbuild_ospray/blob/main/macros.cmake
@@ -59,10 +61,15 @@ set(LOCO_DEP_VERSION_meshcatcpp
     a84be7add7f344d61e615bee7f26e6a7d5444f2a
     CACHE STRING "Version of MeshcatCpp to be fetched (for meshcat visualizer")
 
+set(LOCO_DEP_VERSION_benchmark
+    344117638c8ff7e239044fd0fa7085839fc03021 # Release v1.8.3
+    CACHE STRING "Version of Google Benchmark to be fetched (for benchmarks)")
+
 mark_as_advanced(LOCO_DEP_VERSION_mujoco)
 mark_as_advanced(LOCO_DEP_VERSION_bullet)
 mark_as_advanced(LOCO_DEP_VERSION_dart)
 mark_as_advanced(LOCO_DEP_VERSION_catch2)
+mark_as_advanced(LOCO_DEP_VERSION_benchmark)
 mark_as_advanced(LOCO_DEP_VERSION_tinyxml2)
 mark_as_advanced(LOCO_DEP_VERSION_renderer)
 mark_as_advanced(LOCO_DEP_VERSION_utils)
@@ -117,6 +124,10 @@ if(LOCO_BUILD_BACKEND_BULLET)
   set(BUILD_ENET OFF CACHE BOOL "" FORCE)
   set(BUILD_OPENGL3_DEMOS OFF CACHE BOOL "" FORCE)
   set(BUILD_UNIT_TESTS OFF CACHE BOOL "" FORCE)
+  if(LOCO_BUILD_BULLET_MULTITHREADING)
+    # Required for btDiscreteDynamicsWorldMt and the task schedulers
+    set(BULLET2_MULTITHREADING ON CACHE BOOL "" FORCE)
+  endif()
 
   loco_find_or_fetch_dependency(
     USE_SYSTEM_PACKAGE ${FIND_OR_FETCH_USE_SYSTEM_PACKAGE}
@@ -250,6 +261,27 @@ if (catch2_POPULATED)
   list(APPEND CMAKE_MODULE_PATH "${catch2_SOURCE_DIR}/contrib")
 endif()
 
+# ------------------------------------------------------------------------------
+# Google Benchmark is used for micro-benchmarks of the hot paths of the C++ API.
+# Its JSON reports are what we track across releases
+# ------------------------------------------------------------------------------
+if (LOCO_BUILD_BENCHMARKS)
+  set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+  set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+  set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+
+  loco_find_or_fetch_dependency(
+    USE_SYSTEM_PACKAGE FALSE
+    PACKAGE_NAME benchmark
+    LIBRARY_NAME benchmark
+    GIT_REPO https://github.com/google/benchmark.git
+    GIT_TAG ${LOCO_DEP_VERSION_benchmark}
+    GIT_PROGRESS FALSE
+    GIT_SHALLOW TRUE
+    TARGETS benchmark::benchmark benchmark::benchmark_main
+    EXCLUDE_FROM_ALL)
+endif()
+
 # ------------------------------------------------------------------------------
 # MeshCatCpp is a self contained C++ interface of the MeshCat visualizer. It
 # allows us to integrate MeshCat as one more visualizer one minto Loco
@@ -327,4 +359,10 @@ loco_find_or_fetch_dependency(
   TARGETS math::math
   EXCLUDE_FROM_ALL)
 
+# ------------------------------------------------------------------------------
+# 'Threads' is used by our executor to step independent simulations in parallel
+# ------------------------------------------------------------------------------
+set(THREADS_PREFER_PTHREAD_FLAG ON)
+find_package(Threads REQUIRED)
+
 # cmake-format: on
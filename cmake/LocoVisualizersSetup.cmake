@@ -23,6 +23,7 @@ if(LOCO_BUILD_VISUALIZER_MESHCAT)
     LocoCoreCpp
     PRIVATE ${SOURCE_DIR}/visualizers/meshcat/common_meshcat.cpp
             ${SOURCE_DIR}/visualizers/meshcat/drawable_impl_meshcat.cpp
+            ${SOURCE_DIR}/visualizers/meshcat/pose_batch_meshcat.cpp
             ${SOURCE_DIR}/visualizers/meshcat/visualizer_impl_meshcat.cpp)
   target_link_libraries(LocoCoreCpp PUBLIC MeshcatCpp::MeshcatCpp)
   target_compile_definitions(LocoCoreCpp
@@ -8,7 +8,31 @@
 namespace loco {
 namespace bullet {
 
-/// Implements the simulation API for the Bullet backend
+/// Interface of our worlds used to step a fixed number of substeps
+class IFixedStepWorld;
+
+/// \brief Implements the simulation API for the Bullet backend
+///
+/// By default, a btDiscreteDynamicsWorld with a sequential-impulse solver is
+/// used. If SimulationConfig::multithreaded is set (and loco was built with
+/// LOCO_BUILD_BULLET_MULTITHREADING), a btDiscreteDynamicsWorldMt is used
+/// instead, with a pool of solvers that run the simulation islands in
+/// parallel. Notice that Bullet supports a single task scheduler per process,
+/// so the scheduler of the last multithreaded world created is the one used.
+///
+/// In fixed-substeps mode, each step takes exactly ceil(step / timestep)
+/// internal steps of size timestep, bypassing stepSimulation: there's no
+/// leftover time nor interpolation, so motion states hold the actual state of
+/// the bodies. Gravity and the forces applied before the step act on all the
+/// substeps, like in the default mode. Switching to this mode drops the
+/// leftover time accumulated by the default mode.
+///
+/// Snapshots hold the kinematic and activation state of every object, but not
+/// Bullet's contact cache (the persistent manifolds used to warmstart the
+/// solver), which is rebuilt from scratch when loading a snapshot. Replaying
+/// the steps after loading a snapshot is always deterministic, but it only
+/// matches the steps originally taken after saving it if the snapshot was
+/// saved from a contact-free state (e.g. right after creating the world).
 class SimulationImplBullet : public core::SimulationImpl {
     // cppcheck-suppress unknownMacro
     NO_COPY_NO_MOVE_NO_ASSIGN(SimulationImplBullet)
@@ -17,9 +41,10 @@ class SimulationImplBullet : public core::SimulationImpl {
 
  public:
     /// Creates an adapter to interact with the internal Bullet simulation
-    explicit SimulationImplBullet(core::Scenario::ptr scenario);
+    explicit SimulationImplBullet(core::Scenario::ptr scenario,
+                                  const SimulationConfig& config);
 
-    ~SimulationImplBullet() override = default;
+    ~SimulationImplBullet() override;
 
     auto Init() -> void override;
 
@@ -31,17 +56,64 @@ class SimulationImplBullet : public core::SimulationImpl {
 
     auto SetGravity(const Vec3& gravity) -> void override;
 
+    auto state_size() const -> size_t override;
+
+    auto SaveState(uint8_t* buffer) const -> void override;
+
+    auto LoadState(const uint8_t* buffer) -> void override;
+
+    /// \brief Enables or disables the fixed-substeps stepping mode
+    ///
+    /// \param[in] enabled Whether or not to step a fixed number of substeps
+    auto SetFixedSubsteps(bool enabled) -> void;
+
+    /// Returns whether or not the fixed-substeps mode is enabled
+    auto fixed_substeps() const -> bool { return m_FixedSubsteps; }
+
+    /// \brief Returns the number of substeps taken in fixed-substeps mode
+    ///
+    /// \param[in] step The amount of time we want to step the simulation
+    auto num_substeps(Scalar step) const -> size_t;
+
+    /// \brief Returns whether or not the world is a multithreaded one
+    ///
+    /// It's false if a multithreaded world was requested but isn't available
+    /// (loco built without LOCO_BUILD_BULLET_MULTITHREADING), in which case a
+    /// single-threaded world is used instead
+    auto multithreaded() const -> bool {
+        return m_ConstraintSolverMt != nullptr;
+    }
+
+    /// Returns the number of internal steps taken during the last step
+    auto last_num_substeps() const -> size_t { return m_LastNumSubsteps; }
+
+    /// Returns the number of internal steps taken since initialization
+    auto num_substeps_taken() const -> size_t { return m_NumSubstepsTaken; }
+
     /// Returns a mutable reference to the internal bullet world
     auto bullet_world() -> btDynamicsWorld&;
 
     /// Returns an unmutable reference to the internal bullet world
     auto bullet_world() const -> const btDynamicsWorld&;
 
+ protected:
+    /// Updates the counters of the last step from the state of the world
+    auto _UpdateStats() -> void;
+
+    /// Drops the contact cache of the world (overlapping pairs and persistent
+    /// manifolds), and recomputes the pairs from the current transforms
+    auto _ResetContactCache() -> void;
+
  protected:
     /// Bullet's dynamics world used to simulate our scenario
     std::unique_ptr<btDynamicsWorld> m_World = nullptr;
-    /// Bullet's constraint solver used for the simulation
+    /// The same world, used to step it in fixed-substeps mode
+    IFixedStepWorld* m_FixedStepWorld = nullptr;
+    /// Bullet's constraint solver used for the simulation (a pool of solvers
+    /// when using a multithreaded world)
     std::unique_ptr<btConstraintSolver> m_ConstraintSolver = nullptr;
+    /// Bullet's solver used for large islands in multithreaded worlds
+    std::unique_ptr<btConstraintSolver> m_ConstraintSolverMt = nullptr;
     /// Bullet's collision dispatcher used for collision detection
     std::unique_ptr<btCollisionDispatcher> m_CollisionDispatcher = nullptr;
     /// Bullet's collision configuration used for collision detection
@@ -53,6 +125,13 @@ class SimulationImplBullet : public core::SimulationImpl {
     btScalar m_FixedTimeStep = static_cast<btScalar>(1e-3);
     /// Max. number of fixed simulation steps possible
     size_t m_MaxSubSteps = 20;
+
+    /// Whether or not we step a fixed number of substeps
+    bool m_FixedSubsteps = false;
+    /// Number of internal steps taken during the last call to Step
+    size_t m_LastNumSubsteps = 0;
+    /// Number of internal steps taken since the world was created
+    size_t m_NumSubstepsTaken = 0;
 };
 
 }  // namespace bullet
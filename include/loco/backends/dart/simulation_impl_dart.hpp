@@ -8,7 +8,12 @@
 namespace loco {
 namespace dart {
 
-/// Implements the simulation API for the Bullet backend
+/// \brief Implements the simulation API for the DART backend
+///
+/// The collision detector used by the constraint solver is selected through
+/// SimulationConfig::collision_detector (ODE by default). When using fixed
+/// substeps, each step calls World::step() exactly round(step / timestep)
+/// times, instead of looping until the world's time advanced enough.
 class SimulationImplDart : public core::SimulationImpl {
     // cppcheck-suppress unknownMacro
     NO_COPY_NO_MOVE_NO_ASSIGN(SimulationImplDart)
@@ -16,8 +21,9 @@ class SimulationImplDart : public core::SimulationImpl {
     DEFINE_SMART_POINTERS(SimulationImplDart)
 
  public:
-    /// Creates an adapter to interact with the internal Bullet simulation
-    explicit SimulationImplDart(core::Scenario::ptr scenario);
+    /// Creates an adapter to interact with the internal DART simulation
+    explicit SimulationImplDart(core::Scenario::ptr scenario,
+                                const SimulationConfig& config);
 
     ~SimulationImplDart() override = default;
 
@@ -31,6 +37,17 @@ class SimulationImplDart : public core::SimulationImpl {
 
     auto SetGravity(const Vec3& gravity) -> void override;
 
+    auto state_size() const -> size_t override;
+
+    auto SaveState(uint8_t* buffer) const -> void override;
+
+    auto LoadState(const uint8_t* buffer) -> void override;
+
+    /// \brief Returns the number of substeps taken in fixed-substeps mode
+    ///
+    /// \param[in] step The amount of time we want to step the simulation
+    auto num_substeps(Scalar step) const -> size_t;
+
     /// Returns a mutable reference to the internal dart world
     auto dart_world() -> ::dart::simulation::World& { return *m_World; }
 
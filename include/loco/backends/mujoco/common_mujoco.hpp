@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include <mujoco/mujoco.h>
 
 #include <loco/core/common.hpp>
@@ -7,11 +9,19 @@
 namespace loco {
 namespace mujoco {
 
-/// Deleter for mjModel (when using unique_ptr)
+/// Deleter for mjModel (used by CreateModelPtr)
 struct MjcModelDeleter {
     auto operator()(mjModel* ptr) const -> void;
 };
 
+/// Shared handle to a compiled mjModel (only create it with CreateModelPtr)
+using MjcModelPtr = std::shared_ptr<mjModel>;
+
+/// \brief Takes ownership of the given model, freed with mj_deleteModel
+///
+/// \param[in] model A model created by MuJoCo (e.g. by mj_loadXML)
+auto CreateModelPtr(mjModel* model) -> MjcModelPtr;
+
 /// Deleter for mjData (when using unique_ptr)
 struct MjcDataDeleter {
     auto operator()(mjData* ptr) const -> void;
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <loco/backends/mujoco/common_mujoco.hpp>
+#include <loco/core/thread_pool_t.hpp>
+
+namespace loco {
+namespace mujoco {
+
+/// \brief Pool of mjData instances that share a single compiled mjModel
+///
+/// MuJoCo keeps all the mutable simulation state in mjData, while mjModel is
+/// only read during stepping. So, K rollouts of the same model only need K
+/// mjData structs, instead of K compiled copies of the model. Each mjData in
+/// the pool must only be used by one thread at a time, while the model can be
+/// shared by all of them.
+class DataPoolMujoco {
+    // cppcheck-suppress unknownMacro
+    NO_COPY_NO_MOVE_NO_ASSIGN(DataPoolMujoco)
+
+    DEFINE_SMART_POINTERS(DataPoolMujoco)
+
+ public:
+    /// Callable used to run a job using a single mjData of the pool
+    using DataFn =
+        std::function<void(size_t index, const mjModel& model, mjData& data)>;
+
+    /// \brief Creates a pool with the given number of mjData for the model
+    ///
+    /// \param[in] model The compiled model shared by all mjData of this pool
+    /// \param[in] num_datas The number of mjData instances to create
+    explicit DataPoolMujoco(std::shared_ptr<const mjModel> model,
+                            size_t num_datas);
+
+    /// Releases all mjData instances of this pool
+    ~DataPoolMujoco() = default;
+
+    /// \brief Copies the state of the given mjData into all mjData of the pool
+    ///
+    /// \param[in] src The mjData (created for the same model) to copy from
+    auto CopyFrom(const mjData& src) -> void;
+
+    /// \brief Resets the mjData at the given index to the model's defaults
+    ///
+    /// \param[in] index The index of the mjData we want to reset
+    auto ResetData(size_t index) -> void;
+
+    /// \brief Runs fn for every mjData of the pool
+    ///
+    /// If a thread pool is given, the jobs run concurrently (at most one job
+    /// per mjData), otherwise they run sequentially in the calling thread
+    ///
+    /// \param[in] fn The job to run with each mjData of the pool
+    /// \param[in] thread_pool Optional thread pool used to run the jobs
+    auto ForEach(const DataFn& fn, core::ThreadPool* thread_pool = nullptr)
+        -> void;
+
+    /// \brief Steps every mjData of the pool a given number of times
+    ///
+    /// \param[in] num_steps The number of calls to mj_step for each mjData
+    /// \param[in] thread_pool Optional thread pool used to step in parallel
+    auto StepAll(size_t num_steps, core::ThreadPool* thread_pool = nullptr)
+        -> void;
+
+    /// Returns the number of mjData instances in this pool
+    auto size() const -> size_t { return m_Datas.size(); }
+
+    /// Returns the model shared by all mjData of this pool
+    auto model() const -> const mjModel& { return *m_Model; }
+
+    /// Returns a mutable reference to the mjData at the given index
+    auto data(size_t index) -> mjData&;
+
+    /// Returns an unmutable reference to the mjData at the given index
+    auto data(size_t index) const -> const mjData&;
+
+    /// Returns a string representation of this pool
+    auto ToString() const -> std::string;
+
+ protected:
+    /// The compiled model shared by all mjData of this pool
+    std::shared_ptr<const mjModel> m_Model = nullptr;
+
+    /// The mjData instances of this pool, one per rollout
+    std::vector<std::unique_ptr<mjData, MjcDataDeleter>> m_Datas;
+};
+
+}  // namespace mujoco
+}  // namespace loco
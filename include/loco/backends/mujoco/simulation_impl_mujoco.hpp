@@ -1,14 +1,25 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include <loco/backends/mujoco/common_mujoco.hpp>
+#include <loco/backends/mujoco/data_pool_mujoco.hpp>
 #include <loco/core/impl/simulation_impl.hpp>
 
 namespace loco {
 namespace mujoco {
 
-/// Implements the simulation API for the MuJoCo backend
+/// \brief Implements the simulation API for the MuJoCo backend
+///
+/// By default, Step(step) calls mj_step until the simulation time advanced by
+/// the requested amount, which can take an extra substep depending on the
+/// accumulated floating-point error. In fixed-substeps mode, the number of
+/// substeps is computed once as round(step / timestep), and each substep is
+/// split into mj_step1 and mj_step2, so a control callback can set the
+/// controls and applied forces in between, using the positions and velocities
+/// computed by mj_step1. Note that MuJoCo uses the Euler integrator when
+/// stepping in two phases (RK4 is only available through mj_step).
 class SimulationImplMujoco : public core::SimulationImpl {
     // cppcheck-suppress unknownMacro
     NO_COPY_NO_MOVE_NO_ASSIGN(SimulationImplMujoco)
@@ -17,7 +28,8 @@ class SimulationImplMujoco : public core::SimulationImpl {
 
  public:
     /// Creates an adapter to interact with the internal MuJoCo simulation
-    explicit SimulationImplMujoco(core::Scenario::ptr scenario);
+    explicit SimulationImplMujoco(core::Scenario::ptr scenario,
+                                  const SimulationConfig& config);
 
     ~SimulationImplMujoco() override = default;
 
@@ -31,6 +43,43 @@ class SimulationImplMujoco : public core::SimulationImpl {
 
     auto SetGravity(const Vec3& gravity) -> void override;
 
+    auto state_size() const -> size_t override;
+
+    auto SaveState(uint8_t* buffer) const -> void override;
+
+    auto LoadState(const uint8_t* buffer) -> void override;
+
+    /// Callable used to set the controls (ctrl, qfrc_applied, etc.) between
+    /// the two phases of each substep, when using fixed substeps
+    using ControlCallback = std::function<void(const mjModel&, mjData&)>;
+
+    /// \brief Enables or disables the fixed-substeps stepping mode
+    ///
+    /// \param[in] enabled Whether or not to step a fixed number of substeps
+    auto SetFixedSubsteps(bool enabled) -> void;
+
+    /// \brief Sets the callback applied between mj_step1 and mj_step2
+    ///
+    /// \param[in] callback The control callback (can be empty to disable it)
+    auto SetControlCallback(ControlCallback callback) -> void;
+
+    /// Returns whether or not the fixed-substeps mode is enabled
+    auto fixed_substeps() const -> bool { return m_FixedSubsteps; }
+
+    /// \brief Returns the number of substeps taken for the given step
+    ///
+    /// \param[in] step The amount of time we want to step the simulation
+    auto num_substeps(Scalar step) const -> size_t;
+
+    /// \brief Creates a pool of mjData that shares the model of this backend
+    ///
+    /// Every mjData of the pool starts from the current state of this
+    /// simulation. The pool keeps the model alive, and must only be used while
+    /// the model isn't being modified (e.g. by SetTimeStep or SetGravity)
+    ///
+    /// \param[in] num_datas The number of mjData (i.e. rollouts) in the pool
+    auto CreateDataPool(size_t num_datas) const -> DataPoolMujoco::uptr;
+
     /// Returns a mutable reference to the internal MuJoCo simulation model
     auto mujoco_model() -> mjModel&;
 
@@ -50,12 +99,24 @@ class SimulationImplMujoco : public core::SimulationImpl {
     auto mujoco_scene() const -> const mjvScene&;
 
  protected:
-    /// Model struct containing the simulation structure
-    std::unique_ptr<mjModel, MjcModelDeleter> m_Model = nullptr;
+    /// \brief Takes ownership of the given model, and creates its data
+    ///
+    /// \param[in] model A compiled model, to be freed with mj_deleteModel
+    auto _SetModel(mjModel* model) -> void;
+
+ protected:
+    /// Model struct containing the simulation structure (shared with the
+    /// pools of mjData created from this backend)
+    MjcModelPtr m_Model = nullptr;
     /// Data struct containing simulation data
     std::unique_ptr<mjData, MjcDataDeleter> m_Data = nullptr;
     /// Scene struct containing visualization data
     std::unique_ptr<mjvScene, MjvSceneDeleter> m_Scene = nullptr;
+
+    /// Whether or not we step a fixed number of substeps
+    bool m_FixedSubsteps = false;
+    /// Callback used to apply controls between mj_step1 and mj_step2
+    ControlCallback m_ControlCallback = nullptr;
 };
 
 }  // namespace mujoco
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+
+#include <loco/core/common.hpp>
+
+namespace loco {
+namespace core {
+
+/// \brief Process-wide cache of mesh and heightfield assets
+///
+/// Assets are keyed by a hash of their contents (vertex, face and height
+/// bytes, plus their dimensions), so identical assets created independently
+/// (e.g. the same mesh loaded for every env of a batch, or for both the
+/// collider and the drawable of a body) are detected and stored only once:
+/// Share() swaps the buffers of a given asset for the ones of the first
+/// identical asset seen, so copies end up sharing the same storage.
+///
+/// Backends can also cache the geometry they cook out of an asset (e.g. a
+/// triangle-mesh BVH, or an id of a mesh already in a model) with
+/// GetOrCreate(), under the key returned by Share(), so that geometry is built
+/// once per unique asset instead of once per object using it.
+///
+/// The cache only holds weak references to its entries, so assets and
+/// geometries are released as soon as the objects using them are gone. The
+/// entries left expired are dropped as the cache grows, or by Prune().
+///
+/// Thread safety: all methods can be called from any thread.
+class AssetCache {
+ public:
+    /// Key of an asset (0 is reserved for empty assets, which aren't cached)
+    using Key = uint64_t;
+
+    /// \brief Shares the buffers of the given mesh with an identical one
+    ///
+    /// If an identical mesh was shared before, the buffers of the given mesh
+    /// are replaced by the cached ones, otherwise the mesh is cached
+    ///
+    /// \param[in,out] mesh_data The mesh whose buffers should be shared
+    /// \return The key of the mesh in the cache (0 if the mesh is empty)
+    static auto Share(MeshData& mesh_data) -> Key;
+
+    /// \brief Shares the buffer of the given heightfield with an identical one
+    ///
+    /// If an identical heightfield was shared before, the buffer of the given
+    /// heightfield is replaced by the cached one, otherwise it's cached
+    ///
+    /// \param[in,out] hfield_data The heightfield whose buffer should be shared
+    /// \return The key of the heightfield in the cache (0 if it's empty)
+    static auto Share(HeightfieldData& hfield_data) -> Key;
+
+    /// \brief Shares the assets used by the given shape (if any)
+    ///
+    /// \param[in,out] shape_data The shape whose mesh or hfield to be shared
+    /// \return The key of the asset of the shape (0 for other shapes)
+    static auto Share(ShapeData& shape_data) -> Key;
+
+    /// \brief Shares the mesh of the given shape, if it was loaded from a file
+    ///
+    /// Used when creating colliders and drawables. Meshes loaded from files
+    /// are usually used by many objects, while procedural assets (e.g. a
+    /// terrain per env) are usually unique, and hashing them would only add
+    /// cost. Those can still be shared explicitly with Share()
+    ///
+    /// \param[in,out] shape_data The shape whose mesh is to be shared
+    /// \return The key of the mesh of the shape (0 if it wasn't shared)
+    static auto ShareIfLoaded(ShapeData& shape_data) -> Key;
+
+    /// \brief Returns the key of the given mesh (a hash of its contents)
+    ///
+    /// \param[in] mesh_data The mesh to be hashed
+    static auto ComputeKey(const MeshData& mesh_data) -> Key;
+
+    /// \brief Returns the key of the given heightfield (a hash of its contents)
+    ///
+    /// \param[in] hfield_data The heightfield to be hashed
+    static auto ComputeKey(const HeightfieldData& hfield_data) -> Key;
+
+    /// \brief Returns the geometry of type T built from the given asset
+    ///
+    /// The geometry is created with the given function only if there's none
+    /// alive for this key (and type); otherwise the existing one is returned
+    ///
+    /// \param[in] key The key of the asset, as returned by Share()
+    /// \param[in] create Function that builds the geometry of the asset
+    template <typename T>
+    static auto GetOrCreate(Key key,
+                            const std::function<std::shared_ptr<T>()>& create)
+        -> std::shared_ptr<T> {
+        return std::static_pointer_cast<T>(_GetOrCreate(
+            key, std::type_index(typeid(T)),
+            [&create]() -> std::shared_ptr<void> { return create(); }));
+    }
+
+    /// \brief Drops the entries whose assets or geometries were released
+    ///
+    /// \return The number of entries dropped
+    static auto Prune() -> size_t;
+
+    /// Drops all entries of the cache (objects using them keep them alive)
+    static auto Clear() -> void;
+
+    /// Returns the number of unique meshes alive in the cache
+    static auto num_meshes() -> size_t;
+
+    /// Returns the number of unique heightfields alive in the cache
+    static auto num_hfields() -> size_t;
+
+    /// Returns the number of backend geometries alive in the cache
+    static auto num_geometries() -> size_t;
+
+ private:
+    /// Type-erased implementation of GetOrCreate()
+    static auto _GetOrCreate(
+        Key key, std::type_index type,
+        const std::function<std::shared_ptr<void>()>& create)
+        -> std::shared_ptr<void>;
+};
+
+}  // namespace core
+}  // namespace loco
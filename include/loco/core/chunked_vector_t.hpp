@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <utils/logging.hpp>
+
+namespace loco {
+namespace core {
+
+/// \brief Growable array of elements stored in fixed-size chunks
+///
+/// Unlike std::vector, growing never moves the elements already stored (a new
+/// chunk is allocated instead), so pointers and references to the elements
+/// remain valid for the whole lifetime of the container, and there's no
+/// upper bound on the number of elements that needs to be reserved up front.
+/// Indexing costs a division and an extra indirection (CHUNK_SIZE should be a
+/// power of two, so the division becomes a shift).
+///
+/// Elements are default-constructed a whole chunk at a time, so T must be
+/// default-constructible and move-assignable.
+template <typename T, size_t CHUNK_SIZE = 256>
+class ChunkedVector {
+    static_assert(CHUNK_SIZE > 0, "ChunkedVector requires non-empty chunks");
+
+    // cppcheck-suppress unknownMacro
+    NO_COPY_NO_MOVE_NO_ASSIGN(ChunkedVector)
+
+ public:
+    /// Creates an empty container (no chunks are allocated until needed)
+    ChunkedVector() = default;
+
+    /// Releases all chunks (and the elements stored in them)
+    ~ChunkedVector() = default;
+
+    /// \brief Allocates the chunks required to hold the given elements
+    ///
+    /// \param[in] capacity The number of elements we expect to store
+    auto Reserve(size_t capacity) -> void {
+        while (this->capacity() < capacity) {
+            _AddChunk();
+        }
+    }
+
+    /// \brief Appends an element at the end of the container
+    ///
+    /// \param[in] value The element to be moved into the container
+    /// \return A reference to the stored element (valid until destroyed)
+    auto push_back(T value) -> T& {
+        if (m_Size == capacity()) {
+            _AddChunk();
+        }
+        auto& element = (*this)[m_Size++];
+        element = std::move(value);
+        return element;
+    }
+
+    /// Returns the element at the given index (no bounds checking)
+    auto operator[](size_t index) -> T& {
+        return m_Chunks[index / CHUNK_SIZE][index % CHUNK_SIZE];
+    }
+
+    /// Returns the element at the given index (no bounds checking)
+    auto operator[](size_t index) const -> const T& {
+        return m_Chunks[index / CHUNK_SIZE][index % CHUNK_SIZE];
+    }
+
+    /// Returns the number of elements stored
+    auto size() const -> size_t { return m_Size; }
+
+    /// Returns the number of elements that fit in the allocated chunks
+    auto capacity() const -> size_t { return m_Chunks.size() * CHUNK_SIZE; }
+
+    /// Returns the number of chunks allocated so far
+    auto num_chunks() const -> size_t { return m_Chunks.size(); }
+
+    /// Returns whether or not there are no elements stored
+    auto empty() const -> bool { return m_Size == 0; }
+
+ private:
+    /// Allocates a new chunk of default-constructed elements
+    auto _AddChunk() -> void {
+        // NOLINTNEXTLINE
+        m_Chunks.emplace_back(new T[CHUNK_SIZE]());
+    }
+
+ private:
+    /// The chunks where the elements are stored
+    std::vector<std::unique_ptr<T[]>> m_Chunks;  // NOLINT
+
+    /// The number of elements stored
+    size_t m_Size = 0;
+};
+
+}  // namespace core
+}  // namespace loco
@@ -18,6 +18,9 @@
 
 #include <utils/logging.hpp>
 
+#include <loco/core/shared_buffer_t.hpp>
+#include <loco/core/trace_session_t.hpp>
+
 using Scalar = float;
 using Vec2 = ::math::Vector2<Scalar>;
 using Vec3 = ::math::Vector3<Scalar>;
@@ -128,16 +131,51 @@ enum class eDynamicsType {
 /// Returns the string representation of the given dynamics option
 auto ToString(const eDynamicsType& dyn_type) -> std::string;
 
+/// Represents the collision detectors a backend can be configured to use
+enum class eCollisionDetectorType {
+    /// Uses the default collision detector of the backend
+    DEFAULT,
+    /// Uses the Flexible Collision Library (FCL)
+    FCL,
+    /// Uses the collision detector from the Open Dynamics Engine (ODE)
+    ODE,
+    /// Uses the collision detector from Bullet
+    BULLET,
+    /// Uses the native collision detector of DART
+    DART,
+};
+
+/// Returns the string representation of the given collision detector option
+auto ToString(const eCollisionDetectorType& detector_type) -> std::string;
+
+/// Represents the task schedulers used by multithreaded backends
+enum class eTaskSchedulerType {
+    /// Uses a scheduler built on top of std::thread
+    STD_THREAD,
+    /// Uses a scheduler built on top of OpenMP
+    OPENMP,
+    /// Uses a scheduler built on top of Intel's TBB
+    TBB,
+};
+
+/// Returns the string representation of the given task scheduler option
+auto ToString(const eTaskSchedulerType& scheduler_type) -> std::string;
+
 /// Represents user-defined mesh data (for convex and triangular shapes)
+///
+/// The vertex and index buffers are shared (reference-counted) between copies,
+/// so copying a MeshData (e.g. through ShapeData, or when creating many bodies
+/// from the same mesh) doesn't copy the buffers. Writing into a buffer through
+/// mutable_data() gives that copy its own storage first (copy-on-write).
 struct MeshData {
     /// Absolute path to the mesh resource (if creating mesh from file)
     std::string filepath;
     /// User vertex-data of the mesh resource (if creating programmatically)
-    std::unique_ptr<Scalar[]> vertices = nullptr;  // NOLINT
+    SharedBuffer<Scalar> vertices;
     /// Number of elements in the vertices buffer
     size_t n_vertices = 0;
     /// User index-data of the mesh resource (if creating programmatically)
-    std::unique_ptr<uint32_t[]> faces = nullptr;  // NOLINT
+    SharedBuffer<uint32_t> faces;
     /// Number of faces composing this mesh
     size_t n_faces = 0;
 
@@ -149,52 +187,11 @@ struct MeshData {
     /// Releases all allocated resources of this object
     ~MeshData() = default;
 
-    /// Copy constructor for MeshData object. Copies fields if possible, and
-    /// makes deep copies of fields that have ownership (like unique_ptr)
-    MeshData(const MeshData& other)
-        : filepath(other.filepath),
-          n_vertices(other.n_vertices),
-          n_faces(other.n_faces) {
-        // Handle the deep-copy of the vertices buffer --------
-        auto vert_num_scalars = 3 * n_vertices;
-        // NOLINTNEXTLINE
-        vertices = std::unique_ptr<Scalar[]>(new Scalar[vert_num_scalars]);
-        memcpy(vertices.get(), other.vertices.get(),
-               sizeof(Scalar) * vert_num_scalars);
-        // ----------------------------------------------------
-
-        // Handle the deep-copy of the faces buffer -----------
-        auto faces_num_scalars = 3 * n_faces;
-        // NOLINTNEXTLINE
-        faces = std::unique_ptr<uint32_t[]>(new uint32_t[faces_num_scalars]);
-        memcpy(faces.get(), other.faces.get(),
-               sizeof(Scalar) * faces_num_scalars);
-        // ----------------------------------------------------
-    }
+    /// Copy constructor for MeshData object. The buffers are shared, not copied
+    MeshData(const MeshData& other) = default;
 
-    /// Copy assignment operator for MeshData object. Similarly to the copy
-    /// constructor, make a full copy of all attributes
-    auto operator=(const MeshData& other) -> MeshData& {
-        filepath = other.filepath;
-        n_vertices = other.n_vertices;
-        n_faces = other.n_faces;
-        // Handle the deep-copy of the vertices buffer --------
-        auto vert_num_scalars = 3 * n_vertices;
-        // NOLINTNEXTLINE
-        vertices = std::unique_ptr<Scalar[]>(new Scalar[vert_num_scalars]);
-        memcpy(vertices.get(), other.vertices.get(),
-               sizeof(Scalar) * vert_num_scalars);
-        // ----------------------------------------------------
-
-        // Handle the deep-copy of the faces buffer -----------
-        auto faces_num_scalars = 3 * n_faces;
-        // NOLINTNEXTLINE
-        faces = std::unique_ptr<uint32_t[]>(new uint32_t[faces_num_scalars]);
-        memcpy(faces.get(), other.faces.get(),
-               sizeof(Scalar) * faces_num_scalars);
-        return *this;
-        // ----------------------------------------------------
-    }
+    /// Copy assignment operator for MeshData object. The buffers are shared
+    auto operator=(const MeshData& other) -> MeshData& = default;
 
     /// Move constructor, transfers ownership of other object's data
     MeshData(MeshData&& other) noexcept
@@ -233,13 +230,16 @@ struct MeshData {
 };
 
 /// Represents user-defined heightfield data (for heightfield shapes)
+///
+/// Similarly to MeshData, the elevation buffer is shared between copies, and
+/// copied only when written through mutable_data() (copy-on-write).
 struct HeightfieldData {
     /// Number of samples of the hfield's area in the x-dimension
     size_t n_width_samples = 0;
     /// Number of samples of the hfield's area in the y-dimension
     size_t n_depth_samples = 0;
     /// Elevation data stored in row-major order, and normalized to range [0-1]
-    std::unique_ptr<Scalar[]> heights = nullptr;  // NOLINT
+    SharedBuffer<Scalar> heights;
 
     // RAII (make sure that we can also export bindings correctly) -------
 
@@ -249,34 +249,11 @@ struct HeightfieldData {
     /// Releases all allocated resources of this object
     ~HeightfieldData() = default;
 
-    /// Copy constructor for HeightfieldData object. Copies fields if possible,
-    /// and makes deep copies of fields that have ownership (like unique_ptr)
-    HeightfieldData(const HeightfieldData& other)
-        : n_width_samples(other.n_width_samples),
-          n_depth_samples(other.n_depth_samples) {
-        // Handle the deep-copy of the heights buffer ---------
-        auto grid_num_scalars = n_width_samples * n_depth_samples;
-        // NOLINTNEXTLINE
-        heights = std::unique_ptr<Scalar[]>(new Scalar[grid_num_scalars]);
-        memcpy(heights.get(), other.heights.get(),
-               sizeof(Scalar) * grid_num_scalars);
-        // ----------------------------------------------------
-    }
+    /// Copy constructor for HeightfieldData object. The buffer is shared
+    HeightfieldData(const HeightfieldData& other) = default;
 
-    /// Copy assignment operator for HeightfieldData object. Similarly to the
-    /// copy constructor, make a full copy of all attributes
-    auto operator=(const HeightfieldData& other) -> HeightfieldData& {
-        n_width_samples = other.n_width_samples;
-        n_depth_samples = other.n_depth_samples;
-        // Handle the deep-copy of the heights buffer ---------
-        auto grid_num_scalars = n_width_samples * n_depth_samples;
-        // NOLINTNEXTLINE
-        heights = std::unique_ptr<Scalar[]>(new Scalar[grid_num_scalars]);
-        memcpy(heights.get(), other.heights.get(),
-               sizeof(Scalar) * grid_num_scalars);
-        // ----------------------------------------------------
-        return *this;
-    }
+    /// Copy assignment operator for HeightfieldData. The buffer is shared
+    auto operator=(const HeightfieldData& other) -> HeightfieldData& = default;
 
     /// Move constructor, transfers ownership of other object's data
     HeightfieldData(HeightfieldData&& other) noexcept
@@ -305,6 +282,34 @@ struct HeightfieldData {
     // -------------------------------------------------------------------
 };
 
+/// Represents a rectangular region of the samples of a heightfield
+struct HeightfieldRegion {
+    /// Index of the first sample of the region in the x-dimension
+    size_t width_start = 0;
+    /// Index of the first sample of the region in the y-dimension
+    size_t depth_start = 0;
+    /// Number of samples of the region in the x-dimension
+    size_t n_width_samples = 0;
+    /// Number of samples of the region in the y-dimension
+    size_t n_depth_samples = 0;
+};
+
+/// \brief Writes the given heights into a region of the heightfield
+///
+/// Only the rows of the region are copied, so the cost depends on the size of
+/// the region and not of the whole grid (unless the elevation data is shared
+/// with other heightfields, in which case it's copied first, see SharedBuffer).
+/// If the heightfield has no elevation data for its grid yet, it's allocated
+/// first, with the samples outside of the region set to zero
+///
+/// \param[in,out] hfield_data The heightfield whose heights are to be written
+/// \param[in] region The region of the heightfield to be written
+/// \param[in] ptr_heights The heights of the region (row-major, with
+///                        region.n_width_samples samples per row)
+auto WriteElevationRegion(HeightfieldData& hfield_data,
+                          const HeightfieldRegion& region,
+                          const Scalar* ptr_heights) -> void;
+
 /// Represents the data that fully describes a shape
 struct ShapeData {
     /// Type of this shape
@@ -363,6 +368,26 @@ struct BodyData {
     DrawableData drawable;
 };
 
+/// Represents the options used to configure the backend of a simulation
+struct SimulationConfig {
+    /// Collision detector to be used (only for backends that allow choosing)
+    eCollisionDetectorType collision_detector = eCollisionDetectorType::DEFAULT;
+    /// Whether or not each step takes a fixed, precomputed number of substeps
+    bool fixed_substeps = false;
+    /// Whether or not to use a multithreaded world (only Bullet, for now)
+    bool multithreaded = false;
+    /// Task scheduler used to run the multithreaded world
+    eTaskSchedulerType task_scheduler = eTaskSchedulerType::STD_THREAD;
+    /// Number of threads of the task scheduler (0 uses all hardware threads)
+    size_t num_threads = 0;
+    /// Number of iterations of the constraint solver (0 keeps the default)
+    size_t solver_iterations = 0;
+    /// Whether or not to measure the time spent in collision detection and in
+    /// the constraint solver (only Bullet and MuJoCo, which installs a global
+    /// timer callback for it, if none was installed yet)
+    bool profile_phases = false;
+};
+
 }  // namespace loco
 
 #ifdef LOCO_LOGS_ENABLED
@@ -419,15 +444,25 @@ struct BodyData {
 #define LOCO_ASSERT(x, ...) assert((x))
 #endif
 
+// NOLINTNEXTLINE
+#define LOCO_CONCAT_IMPL(a, b) a##b
+// NOLINTNEXTLINE
+#define LOCO_CONCAT(a, b) LOCO_CONCAT_IMPL(a, b)
+
+// Scopes are recorded by the runtime-togglable ::loco::core::TraceSession. The
+// names (and sessions, used as trace categories) must be string literals
 #ifdef LOCO_PROFILING_ENABLED
 // NOLINTNEXTLINE
-#define LOCO_PROFILE_SCOPE(n) PROFILE_SCOPE(n)
+#define LOCO_PROFILE_SCOPE(n) \
+    ::loco::core::TraceScope LOCO_CONCAT(loco_trace_scope_, __LINE__)(n)
 // NOLINTNEXTLINE
-#define LOCO_PROFILE_SCOPE_IN_SESSION(n, s) PROFILE_SCOPE_IN_SESSION(n, s)
+#define LOCO_PROFILE_SCOPE_IN_SESSION(n, s) \
+    ::loco::core::TraceScope LOCO_CONCAT(loco_trace_scope_, __LINE__)(n, s)
 // NOLINTNEXTLINE
-#define LOCO_PROFILE_FUNCTION() PROFILE_FUNCTION()
+#define LOCO_PROFILE_FUNCTION() LOCO_PROFILE_SCOPE(__func__)
 // NOLINTNEXTLINE
-#define LOCO_PROFILE_FUNCTION_IN_SESSION(s) PROFILE_FUNCTION_IN_SESSION(s)
+#define LOCO_PROFILE_FUNCTION_IN_SESSION(s) \
+    LOCO_PROFILE_SCOPE_IN_SESSION(__func__, s)
 #else
 // NOLINTNEXTLINE
 #define LOCO_PROFILE_SCOPE(n) ((void)0)
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <loco/core/common.hpp>
+
+namespace loco {
+namespace core {
+
+/// Parameters of the approximate convex decomposition of a mesh
+struct ConvexDecompositionParams {
+    /// Maximum number of convex pieces the mesh can be split into
+    size_t max_hulls = 16;
+    /// Maximum number of vertices of each convex piece (0 means no limit)
+    size_t max_vertices_per_hull = 64;
+    /// Maximum concavity allowed for a piece before it's split further, given
+    /// as a fraction of the diagonal of the bounding box of the whole mesh
+    Scalar max_concavity = ToScalar(0.01);
+};
+
+/// \brief Builds convex approximations of meshes, for CONVEX_MESH colliders
+///
+/// The narrowphase cost of convex colliders grows with the number of vertices
+/// of their hulls in all backends, and most backends only support convex
+/// meshes for dynamic bodies. This class computes convex hulls (quickhull),
+/// optionally limited to a maximum number of vertices, and approximate convex
+/// decompositions of concave meshes (the mesh is recursively split at its
+/// most concave region until each piece is close enough to its hull), which
+/// can be turned into the compound children of a collider.
+///
+/// Computing a decomposition can be expensive for large meshes, so it's meant
+/// to be done once per asset (e.g. at load time), not while simulating.
+class ConvexDecomposition {
+ public:
+    /// \brief Computes the convex hull of the vertices of the given mesh
+    ///
+    /// With a vertex limit, the hull is built from the points that extend it
+    /// the most first, so the result is the hull of the max_vertices points
+    /// that best approximate the full hull (slightly smaller than it). If all
+    /// vertices are coplanar, the returned mesh has the vertices but no faces.
+    ///
+    /// \param[in] mesh_data The mesh (or point cloud) to be wrapped
+    /// \param[in] max_vertices The max. number of vertices (0 means no limit)
+    /// \return The hull, with outward-facing (counter-clockwise) triangles
+    static auto ComputeHull(const MeshData& mesh_data, size_t max_vertices = 0)
+        -> MeshData;
+
+    /// \brief Splits the given mesh into a set of approximately convex pieces
+    ///
+    /// \param[in] mesh_data The (possibly concave) triangle mesh to be split
+    /// \param[in] params Parameters of the decomposition
+    /// \return The convex hulls of the pieces (one if the mesh is convex)
+    static auto Decompose(const MeshData& mesh_data,
+                          const ConvexDecompositionParams& params = {})
+        -> std::vector<MeshData>;
+
+    /// \brief Converts the given mesh collider into convex colliders
+    ///
+    /// \param[in] data A collider with a CONVEX_MESH or TRIANGULAR_MESH shape
+    /// \param[in] params Parameters of the decomposition
+    /// \return A CONVEX_MESH collider if the mesh needed a single piece, or
+    ///         otherwise a COMPOUND collider with a CONVEX_MESH child for each
+    ///         piece (children inherit size and filtering and friction params)
+    static auto MakeConvexCollider(const ColliderData& data,
+                                   const ConvexDecompositionParams& params = {})
+        -> ColliderData;
+};
+
+}  // namespace core
+}  // namespace loco
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <utils/logging.hpp>
+
+namespace loco {
+namespace core {
+
+/// \brief Set of bits used to track which objects changed since a sync
+///
+/// Objects mark their own bit when they change, and a consumer visits only
+/// the marked bits (whole words of unmarked bits are skipped at once), which
+/// clears them. An object marked several times before being consumed is only
+/// visited once.
+///
+/// Thread safety: Set() can be called concurrently with itself and with
+/// Consume(). Resize() must not run concurrently with any other method.
+class DirtyBitset {
+    // cppcheck-suppress unknownMacro
+    NO_COPY_NO_MOVE_NO_ASSIGN(DirtyBitset)
+
+    DEFINE_SMART_POINTERS(DirtyBitset)
+
+ public:
+    /// Number of bits stored per word
+    static constexpr size_t BITS_PER_WORD = 64;
+
+    /// Creates an empty bitset
+    DirtyBitset() = default;
+
+    /// Releases the storage of this bitset
+    ~DirtyBitset() = default;
+
+    /// \brief Grows the bitset to hold (at least) the given number of bits
+    ///
+    /// Bits that were already marked keep their value. Never shrinks.
+    ///
+    /// \param[in] num_bits The number of bits we need to track
+    auto Resize(size_t num_bits) -> void;
+
+    /// \brief Marks the bit at the given index (ignored if out of range)
+    ///
+    /// \param[in] index The index of the bit to be marked
+    auto Set(size_t index) -> void {
+        if (index >= m_NumBits) {
+            return;
+        }
+        m_Words[index / BITS_PER_WORD].fetch_or(
+            uint64_t{1} << (index % BITS_PER_WORD), std::memory_order_relaxed);
+    }
+
+    /// Returns whether or not the bit at the given index is marked
+    auto Test(size_t index) const -> bool;
+
+    /// \brief Visits the indices of all marked bits, and clears them
+    ///
+    /// \param[in] func Callable invoked with the index of each marked bit
+    template <typename Func>
+    auto Consume(Func&& func) -> void {
+        const auto NUM_WORDS = _NumWords(m_NumBits);
+        for (size_t w = 0; w < NUM_WORDS; ++w) {
+            if (m_Words[w].load(std::memory_order_relaxed) == 0) {
+                continue;
+            }
+            auto word = m_Words[w].exchange(0, std::memory_order_acq_rel);
+            for (size_t b = 0; word != 0; ++b, word >>= 1U) {
+                if ((word & 1U) != 0) {
+                    func(w * BITS_PER_WORD + b);
+                }
+            }
+        }
+    }
+
+    /// Returns the number of marked bits
+    auto count() const -> size_t;
+
+    /// Returns the number of bits this bitset can track
+    auto size() const -> size_t { return m_NumBits; }
+
+ private:
+    /// Returns the number of words required to store the given bits
+    static auto _NumWords(size_t num_bits) -> size_t {
+        return (num_bits + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    }
+
+ private:
+    /// The words where the bits are stored
+    std::unique_ptr<std::atomic<uint64_t>[]> m_Words = nullptr;  // NOLINT
+
+    /// The number of words allocated (might be more than currently in use)
+    size_t m_Capacity = 0;
+
+    /// The number of bits this bitset can track
+    size_t m_NumBits = 0;
+};
+
+}  // namespace core
+}  // namespace loco
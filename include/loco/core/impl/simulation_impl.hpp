@@ -14,6 +14,37 @@
 namespace loco {
 namespace core {
 
+/// \brief Performance counters of the last step taken by a simulation backend
+///
+/// Counters that a backend can't measure are left at zero. Times are given
+/// in seconds of wall-clock time. Per backend:
+///
+/// * MuJoCo: all counters. The phase times require
+///   SimulationConfig::profile_phases (or a timer callback of the user).
+/// * Bullet: all counters but num_constraint_rows (the solver doesn't expose
+///   its rows). The phase times require SimulationConfig::profile_phases.
+/// * DART: num_steps, num_substeps, num_contacts and step_time (collision
+///   detection runs inside the constraint solver, so the phases of a step
+///   can't be timed separately).
+struct SimulationStats {
+    /// Number of steps taken since the backend was initialized
+    size_t num_steps = 0;
+    /// Number of internal substeps taken during the last step
+    size_t num_substeps = 0;
+    /// Number of active contacts after the last step
+    size_t num_contacts = 0;
+    /// Number of rows of the constraint system solved in the last substep
+    size_t num_constraint_rows = 0;
+    /// Number of pairs that passed the broadphase in the last substep
+    size_t num_broadphase_pairs = 0;
+    /// Time taken by the whole last step
+    double step_time = 0.0;
+    /// Time spent in collision detection during the last step
+    double collision_time = 0.0;
+    /// Time spent in the constraint solver during the last step
+    double solver_time = 0.0;
+};
+
 /// Represents an adapter that links to a specific simulation backend
 class SimulationImpl {
     // cppcheck-suppress unknownMacro
@@ -22,8 +53,9 @@ class SimulationImpl {
     DEFINE_SMART_POINTERS(SimulationImpl)
 
  public:
-    explicit SimulationImpl(Scenario::ptr scenario)
-        : m_Scenario(std::move(scenario)) {}
+    explicit SimulationImpl(Scenario::ptr scenario,
+                            SimulationConfig config = SimulationConfig())
+        : m_Scenario(std::move(scenario)), m_Config(config) {}
 
     /// Clean/Release allocated resources
     virtual ~SimulationImpl() = default;
@@ -43,9 +75,40 @@ class SimulationImpl {
     /// Sets the internal gravity
     virtual auto SetGravity(const Vec3& gravity) -> void = 0;
 
+    /// Returns the number of bytes required to store the full physics state
+    virtual auto state_size() const -> size_t = 0;
+
+    /// \brief Writes the full physics state into the given buffer
+    ///
+    /// \param[out] buffer Preallocated buffer of at least state_size() bytes
+    virtual auto SaveState(uint8_t* buffer) const -> void = 0;
+
+    /// \brief Restores the full physics state from the given buffer
+    ///
+    /// Implementations must not allocate memory in this method, as it's meant
+    /// to be called very often (e.g. rollbacks when planning with MCTS)
+    ///
+    /// \param[in] buffer Buffer of state_size() bytes written by SaveState
+    virtual auto LoadState(const uint8_t* buffer) -> void = 0;
+
+    /// Returns the options this backend was configured with
+    auto config() const -> const SimulationConfig& { return m_Config; }
+
+    /// Returns the performance counters of the last step
+    auto stats() const -> const SimulationStats& { return m_Stats; }
+
+    /// Returns the performance counters of the last step (mutable)
+    auto stats() -> SimulationStats& { return m_Stats; }
+
  protected:
     /// The scenario to be simulated
     Scenario::ptr m_Scenario;
+
+    /// The options used to configure this backend
+    SimulationConfig m_Config;
+
+    /// The performance counters of the last step, filled by the backend
+    SimulationStats m_Stats;
 };
 
 /// Represents a dummy adapter for a scenario (no simulation happens)
@@ -70,6 +133,12 @@ class SimulationImplNone : public SimulationImpl {
     auto SetTimeStep(Scalar step) -> void override {}
 
     auto SetGravity(const Vec3& gravity) -> void override {}
+
+    auto state_size() const -> size_t override { return 0; }
+
+    auto SaveState(uint8_t* buffer) const -> void override {}
+
+    auto LoadState(const uint8_t* buffer) -> void override {}
 };
 
 }  // namespace core
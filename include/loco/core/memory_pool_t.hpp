@@ -0,0 +1,167 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <utils/logging.hpp>
+
+namespace loco {
+namespace core {
+
+/// \brief Allocator of fixed-size blocks, carved out of larger chunks
+///
+/// Freed blocks are pushed into an intrusive free list and handed back by the
+/// next allocations, so allocating and releasing many small objects (e.g.
+/// thousands of debug drawables per frame) doesn't hit the system allocator.
+/// Chunks are only released when the pool itself is destroyed.
+///
+/// Thread safety: Allocate() and Deallocate() can be called concurrently.
+class MemoryPool {
+    // cppcheck-suppress unknownMacro
+    NO_COPY_NO_MOVE_NO_ASSIGN(MemoryPool)
+
+    DEFINE_SMART_POINTERS(MemoryPool)
+
+ public:
+    /// Default number of blocks carved out of each chunk
+    static constexpr size_t BLOCKS_PER_CHUNK = 256;
+
+    /// \brief Creates a pool of blocks of (at least) the given size
+    ///
+    /// \param[in] block_size The size in bytes of each block
+    /// \param[in] blocks_per_chunk The number of blocks per allocated chunk
+    explicit MemoryPool(size_t block_size,
+                        size_t blocks_per_chunk = BLOCKS_PER_CHUNK);
+
+    /// Releases all chunks (all blocks must have been deallocated by now)
+    ~MemoryPool() = default;
+
+    /// Returns a block of memory of block_size() bytes
+    auto Allocate() -> void*;
+
+    /// \brief Gives the given block back to the pool
+    ///
+    /// \param[in] ptr A block previously returned by Allocate() of this pool
+    auto Deallocate(void* ptr) -> void;
+
+    /// Returns the size in bytes of the blocks handed by this pool
+    auto block_size() const -> size_t { return m_BlockSize; }
+
+    /// Returns the number of chunks allocated so far
+    auto num_chunks() const -> size_t;
+
+    /// Returns the number of blocks currently in use
+    auto num_allocated() const -> size_t;
+
+ private:
+    /// Header written into each free block to link it into the free list
+    struct FreeBlock {
+        /// The next free block (nullptr if this is the last one)
+        FreeBlock* next = nullptr;
+    };
+
+    /// Allocates a new chunk and links all its blocks into the free list
+    auto _Grow() -> void;
+
+ private:
+    /// The size in bytes of each block (a multiple of the max. alignment)
+    size_t m_BlockSize = 0;
+
+    /// The number of blocks carved out of each chunk
+    size_t m_BlocksPerChunk = 0;
+
+    /// The chunks of memory owned by this pool
+    std::vector<std::unique_ptr<uint8_t[]>> m_Chunks;  // NOLINT
+
+    /// Head of the list of free blocks
+    FreeBlock* m_FreeList = nullptr;
+
+    /// The number of blocks currently in use
+    size_t m_NumAllocated = 0;
+
+    /// Mutex used to protect the free list and the list of chunks
+    mutable std::mutex m_Mutex;
+};
+
+/// \brief Process-wide allocator for small objects, using pools by size class
+///
+/// Sizes are rounded up to a power of two, and each size class is served by
+/// its own MemoryPool. Requests larger than MAX_POOLED_SIZE go straight to the
+/// global operator new. The pools live until the process exits.
+class SmallObjectAllocator {
+ public:
+    /// Smallest size class (also the alignment of the blocks)
+    static constexpr size_t MIN_POOLED_SIZE = alignof(std::max_align_t);
+    /// Largest size class served by the pools
+    static constexpr size_t MAX_POOLED_SIZE = 1024;
+
+    /// \brief Allocates memory for an object of the given size
+    ///
+    /// \param[in] size The size in bytes of the object
+    static auto Allocate(size_t size) -> void*;
+
+    /// \brief Releases memory returned by Allocate()
+    ///
+    /// \param[in] ptr The memory to be released
+    /// \param[in] size The size in bytes given when allocating it
+    static auto Deallocate(void* ptr, size_t size) -> void;
+
+    /// Returns the number of blocks in use for the given size of objects
+    static auto num_allocated(size_t size) -> size_t;
+
+    /// Returns the number of chunks of the pool for the given size of objects
+    static auto num_chunks(size_t size) -> size_t;
+};
+
+/// \brief Standard allocator backed by the SmallObjectAllocator
+///
+/// Use it with std::allocate_shared (see MakePooled) to put the object and its
+/// control block in a single pooled block.
+template <typename T>
+class PoolAllocator {
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+                  "PoolAllocator doesn't support over-aligned types");
+
+ public:
+    using value_type = T;
+
+    PoolAllocator() noexcept = default;
+
+    template <typename U>
+    // NOLINTNEXTLINE
+    PoolAllocator(const PoolAllocator<U>& /*other*/) noexcept {}
+
+    auto allocate(size_t n) -> T* {
+        return static_cast<T*>(SmallObjectAllocator::Allocate(n * sizeof(T)));
+    }
+
+    auto deallocate(T* ptr, size_t n) noexcept -> void {
+        SmallObjectAllocator::Deallocate(ptr, n * sizeof(T));
+    }
+
+    template <typename U>
+    auto operator==(const PoolAllocator<U>& /*other*/) const -> bool {
+        return true;
+    }
+
+    template <typename U>
+    auto operator!=(const PoolAllocator<U>& /*other*/) const -> bool {
+        return false;
+    }
+};
+
+/// \brief Creates a shared object whose memory comes from the pools
+///
+/// \param[in] args The arguments forwarded to the constructor of the object
+template <typename T, typename... Args>
+auto MakePooled(Args&&... args) -> std::shared_ptr<T> {
+    return std::allocate_shared<T>(PoolAllocator<T>(),
+                                   std::forward<Args>(args)...);
+}
+
+}  // namespace core
+}  // namespace loco
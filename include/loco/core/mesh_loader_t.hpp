@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <loco/core/common.hpp>
+
+namespace loco {
+namespace core {
+
+/// \brief Loads mesh resources (OBJ and STL files) into MeshData objects
+///
+/// The first time a mesh file is loaded, it's parsed and converted into a
+/// compact binary cache file (the vertex and index buffers as stored in
+/// memory, plus a small header). Later loads (e.g. from other processes of a
+/// multi-env job) memory-map that cache instead of parsing the file again, and
+/// the returned buffers point straight into the mapped pages (these are only
+/// copied if written, see SharedBuffer). A cache is considered stale, and
+/// rebuilt, when the size or modification time of the mesh file changes.
+///
+/// Cache files are written into the cache directory of the user by default
+/// ($XDG_CACHE_HOME/loco/meshes, ~/.cache/loco/meshes or
+/// %LOCALAPPDATA%/loco/meshes), so meshes in read-only installs get cached
+/// too. Each cache is named after its mesh file plus a hash of the absolute
+/// path of that file, so meshes with the same name in different directories
+/// never share a cache. If no cache directory can be found, caches are
+/// written next to the mesh files. Failing to write a cache isn't an error
+/// (the parsed mesh is returned anyway).
+///
+/// Thread safety: all methods can be called from any thread.
+class MeshLoader {
+ public:
+    /// Version of the format of the cache files (bumped on any change)
+    static constexpr uint32_t CACHE_VERSION = 1;
+
+    /// Extension appended to the name of the mesh file to name its cache
+    static constexpr const char* CACHE_EXTENSION = ".meshcache";
+
+    /// \brief Loads the mesh at the given path (through its cache if valid)
+    ///
+    /// \param[in] filepath The path to an .obj or .stl file
+    /// \return The mesh data, with filepath set to the given path
+    static auto Load(const std::string& filepath) -> MeshData;
+
+    /// \brief Parses the given mesh file, without using nor writing caches
+    ///
+    /// \param[in] filepath The path to an .obj or .stl file
+    /// \return The mesh data, with filepath set to the given path
+    static auto Parse(const std::string& filepath) -> MeshData;
+
+    /// \brief Sets the directory where cache files are written
+    ///
+    /// The directory (and its parents) is created when writing the first cache
+    ///
+    /// \param[in] dirpath The directory for the caches (empty: the default)
+    static auto SetCacheDirectory(const std::string& dirpath) -> void;
+
+    /// Returns the directory where cache files are written (empty if there's
+    /// none, in which case caches are written next to the mesh files)
+    static auto GetCacheDirectory() -> std::string;
+
+    /// \brief Enables or disables the use of cache files (enabled by default)
+    ///
+    /// \param[in] enabled Whether or not Load() should use cache files
+    static auto SetCacheEnabled(bool enabled) -> void;
+
+    /// \brief Returns the path of the cache file for the given mesh file
+    ///
+    /// \param[in] filepath The path to the mesh file
+    static auto GetCachePath(const std::string& filepath) -> std::string;
+};
+
+}  // namespace core
+}  // namespace loco
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <spdlog/fmt/bundled/format.h>
+
+#include <loco/core/chunked_vector_t.hpp>
+#include <loco/core/common.hpp>
+
+namespace loco {
+namespace core {
+
+/// \brief Stable reference to an object stored in an ObjectRegistry
+///
+/// A handle is just the index of the slot where the object lives, plus the
+/// generation of that slot at the moment the object was inserted. Each time a
+/// slot is freed its generation is bumped, so handles to removed objects are
+/// detected as stale instead of silently pointing to whatever reuses the slot.
+template <typename T>
+struct Handle {
+    /// Index used by handles that don't refer to any object
+    static constexpr uint32_t INVALID_INDEX =
+        std::numeric_limits<uint32_t>::max();
+
+    /// Index of the slot where the referenced object is stored
+    uint32_t index = INVALID_INDEX;
+    /// Generation of the slot when the referenced object was inserted
+    uint32_t generation = 0;
+
+    /// Returns whether or not this handle was ever assigned to an object
+    auto valid() const -> bool { return index != INVALID_INDEX; }
+
+    auto operator==(const Handle& other) const -> bool {
+        return index == other.index && generation == other.generation;
+    }
+
+    auto operator!=(const Handle& other) const -> bool {
+        return !(*this == other);
+    }
+
+    /// Returns a string representation of this handle
+    auto ToString() const -> std::string {
+        return fmt::format("<Handle index={} generation={}>", index,
+                           generation);
+    }
+};
+
+/// \brief Container of shared objects addressed through generational handles
+///
+/// Lookups by handle are O(1) array accesses (no hashing, and no copies of
+/// the shared pointers). Removals are O(1) too, as freed slots are pushed into
+/// a free list to be reused by later insertions. Slots live in a ChunkedVector,
+/// so the registry grows without bound and without moving the slots in use.
+/// Objects are kept alive by the registry until removed.
+///
+/// Thread safety: concurrent lookups are safe, but insertions and removals
+/// must not run concurrently with any other access.
+template <typename T>
+class ObjectRegistry {
+    // cppcheck-suppress unknownMacro
+    NO_COPY_NO_MOVE_NO_ASSIGN(ObjectRegistry)
+
+ public:
+    /// Type of the handles returned by this registry
+    using HandleType = Handle<T>;
+    /// Type of the objects kept by this registry
+    using ObjectPtr = std::shared_ptr<T>;
+
+    /// Number of slots allocated at once when the registry runs out of them
+    static constexpr size_t SLOTS_PER_CHUNK = 256;
+
+    /// Creates an empty registry
+    ObjectRegistry() = default;
+
+    /// Releases all objects still kept by this registry
+    ~ObjectRegistry() = default;
+
+    /// \brief Reserves storage for the given number of objects
+    ///
+    /// \param[in] capacity The number of objects we expect to store
+    auto Reserve(size_t capacity) -> void { m_Slots.Reserve(capacity); }
+
+    /// \brief Stores the given object, reusing a free slot if there's any
+    ///
+    /// \param[in] object The object to be kept by this registry
+    /// \return The handle that refers to the object from now on
+    auto Insert(ObjectPtr object) -> HandleType {
+        uint32_t index = 0;
+        if (!m_FreeSlots.empty()) {
+            index = m_FreeSlots.back();
+            m_FreeSlots.pop_back();
+        } else {
+            index = static_cast<uint32_t>(m_Slots.size());
+            m_Slots.push_back(Slot());
+        }
+        m_Slots[index].object = std::move(object);
+        m_Size++;
+        return {index, m_Slots[index].generation};
+    }
+
+    /// \brief Removes the object referred by the given handle (if still valid)
+    ///
+    /// \param[in] handle The handle to the object to be removed
+    /// \return The removed object (nullptr if the handle was stale)
+    auto Remove(HandleType handle) -> ObjectPtr {
+        if (!IsValid(handle)) {
+            return nullptr;
+        }
+        auto& slot = m_Slots[handle.index];
+        auto object = std::move(slot.object);
+        slot.object = nullptr;
+        slot.generation++;
+        m_FreeSlots.push_back(handle.index);
+        m_Size--;
+        return object;
+    }
+
+    /// Returns whether or not the given handle refers to a stored object
+    auto IsValid(HandleType handle) const -> bool {
+        return handle.index < m_Slots.size() &&
+               m_Slots[handle.index].generation == handle.generation &&
+               m_Slots[handle.index].object != nullptr;
+    }
+
+    /// Returns the object referred by the given handle (nullptr if stale)
+    auto Get(HandleType handle) const -> T* {
+        return IsValid(handle) ? m_Slots[handle.index].object.get() : nullptr;
+    }
+
+    /// Returns the shared object referred by the given handle (or nullptr)
+    auto GetShared(HandleType handle) const -> ObjectPtr {
+        return IsValid(handle) ? m_Slots[handle.index].object : nullptr;
+    }
+
+    /// Returns the handle to the object at the given slot (invalid if empty)
+    auto HandleAt(size_t index) const -> HandleType {
+        if (index >= m_Slots.size() || m_Slots[index].object == nullptr) {
+            return {};
+        }
+        return {static_cast<uint32_t>(index), m_Slots[index].generation};
+    }
+
+    /// Returns the number of objects currently stored
+    auto size() const -> size_t { return m_Size; }
+
+    /// Returns the number of slots (used or free), i.e. the range of indices
+    auto num_slots() const -> size_t { return m_Slots.size(); }
+
+    /// Returns whether or not there are no objects stored
+    auto empty() const -> bool { return m_Size == 0; }
+
+ protected:
+    /// Storage for an object and the generation of the slot it occupies
+    struct Slot {
+        /// The object stored in this slot (nullptr if the slot is free)
+        ObjectPtr object = nullptr;
+        /// Number of times an object has been removed from this slot
+        uint32_t generation = 0;
+    };
+
+    /// The slots where the objects are stored (never moved once allocated)
+    ChunkedVector<Slot, SLOTS_PER_CHUNK> m_Slots;
+
+    /// Indices of the slots that are free to be reused
+    std::vector<uint32_t> m_FreeSlots;
+
+    /// The number of objects currently stored
+    size_t m_Size = 0;
+};
+
+}  // namespace core
+}  // namespace loco
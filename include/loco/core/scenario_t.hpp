@@ -5,13 +5,41 @@
 #include <unordered_map>
 
 #include <loco/core/common.hpp>
+#include <loco/core/dirty_bitset_t.hpp>
+#include <loco/core/object_registry_t.hpp>
 #include <loco/core/single_body/single_body_t.hpp>
+#include <loco/core/single_body/single_body_collider_t.hpp>
 #include <loco/core/visualizer/drawable_t.hpp>
 
 namespace loco {
 namespace core {
 
+/// Stable reference to a free drawable of a scenario
+using DrawableHandle = Handle<Drawable>;
+/// Stable reference to a single body of a scenario
+using SingleBodyHandle = Handle<SingleBody>;
+/// Stable reference to a standalone collider of a scenario
+using ColliderHandle = Handle<SingleBodyCollider>;
+
 /// \brief Representation for the main container of simulated objects
+///
+/// Objects are stored in registries addressed by generational handles, which
+/// are returned when adding the objects. Lookups by handle are O(1) without
+/// hashing nor reference counting, so prefer them in hot loops. Lookups by
+/// name go through a hash map, and are meant to be used at setup time.
+///
+/// There's no limit on the number of objects: storage grows in chunks, so the
+/// objects already added are never moved, and removed objects leave free
+/// slots that are reused by the next additions. Because of these holes, code
+/// iterating by index must go up to num_drawable_slots() and skip nullptr.
+/// The only exception are single bodies, whose states live in a store whose
+/// arrays never move (see BodyStateStore), sized when creating the scenario.
+///
+/// Drawables in a scenario mark their changes in a dirty set, which is sent
+/// to the visualizer backend by SyncDrawables() (see Drawable for details).
+///
+/// Thread safety: a scenario is not synchronized. Adding drawables or bodies
+/// must not overlap with a simulation or visualizer using this same scenario.
 class Scenario {
     // cppcheck-suppress unknownMacro
     NO_COPY_NO_MOVE_NO_ASSIGN(Scenario)
@@ -19,27 +47,58 @@ class Scenario {
     DEFINE_SMART_POINTERS(Scenario)
 
  public:
-    /// Max number of free drawables allowed in a single scene
-    static constexpr size_t MAX_DRAWABLES = 1024;
+    /// Number of single bodies we reserve state storage for, by default (slots
+    /// of bodies that are destroyed or moved elsewhere are reused)
+    static constexpr size_t RESERVED_SINGLE_BODIES = 1024;
+
+    /// Number of standalone colliders we reserve storage for up front
+    static constexpr size_t RESERVED_COLLIDERS = 1024;
 
-    /// Creates a scenario with a default dummy runtime and backend
-    Scenario();
+    /// \brief Creates a scenario with a default dummy runtime and backend
+    ///
+    /// \param[in] max_single_bodies Number of bodies the state store can keep
+    explicit Scenario(size_t max_single_bodies = RESERVED_SINGLE_BODIES);
 
     /// Releases/Frees all allocated resources of this scenario
     ~Scenario();
 
-    /// \brief Adds a given free drawable to the scenario with the given name
+    /// \brief Adds a given free drawable to the scenario
+    ///
+    /// If another drawable with the same name was added before, lookups by
+    /// name return the latest one (both are still reachable by handle)
     ///
     /// \param[in] drawable The drawable we want to add to the scenario
-    /// \param[in] name The name of the drawable in the scenario
-    auto AddDrawable(Drawable::ptr drawable) -> void;
+    /// \return The handle used to refer to the drawable from now on
+    auto AddDrawable(Drawable::ptr drawable) -> DrawableHandle;
+
+    /// \brief Removes the drawable referred by the given handle
+    ///
+    /// The handle (and any copy of it) becomes stale, and the slot of the
+    /// drawable is reused by the next drawable added to the scenario
+    ///
+    /// \param[in] handle The handle returned when adding the drawable
+    /// \return The removed drawable, or nullptr if the handle is stale
+    auto RemoveDrawable(DrawableHandle handle) -> Drawable::ptr;
+
+    /// \brief Returns the drawable referred by the given handle
+    ///
+    /// \param[in] handle The handle returned when adding the drawable
+    /// \return The drawable, or nullptr if the handle is stale
+    auto GetDrawable(DrawableHandle handle) const -> Drawable*;
 
-    /// \brief Returns the drawable at given index
+    /// \brief Returns the handle of the drawable with the given name
+    ///
+    /// \param[in] name The name of the drawable we want to retrieve
+    /// \return The handle to the drawable (invalid if there's no such name)
+    auto FindDrawable(const std::string& name) const -> DrawableHandle;
+
+    /// \brief Returns the drawable at given slot index
     ///
     /// \param[in] index The index of the drawable we want to retrieve
+    /// \return The drawable, or nullptr if the slot is free
     auto GetDrawableByIndex(size_t index) -> Drawable::ptr;
 
-    /// \brief Returns the drawable with given name
+    /// \brief Returns the drawable with given name (meant for setup time)
     ///
     /// \param[in] name The name of the drawable we want to retrieve
     auto GetDrawableByName(const std::string& name) -> Drawable::ptr;
@@ -47,15 +106,86 @@ class Scenario {
     /// Returns the current number of free drawables in this scenario
     auto num_drawables() const -> size_t;
 
+    /// Returns the range of indices for GetDrawableByIndex (including holes)
+    auto num_drawable_slots() const -> size_t;
+
+    /// Sends the pending changes of all changed drawables to their adapters
+    auto SyncDrawables() -> void;
+
+    /// Returns the number of drawables with changes pending to be synced
+    auto num_dirty_drawables() const -> size_t;
+
+    /// \brief Adds a given single body to the scenario
+    ///
+    /// The state of the body is moved into the state store of this scenario,
+    /// so it's kept contiguous with the state of all other bodies. Throws a
+    /// std::runtime_error if the store is full (see the constructor)
+    ///
+    /// \param[in] body The single body we want to add to the scenario
+    /// \return The handle used to refer to the body from now on
+    auto AddSingleBody(SingleBody::ptr body) -> SingleBodyHandle;
+
+    /// \brief Returns the single body referred by the given handle
+    ///
+    /// \param[in] handle The handle returned when adding the body
+    /// \return The single body, or nullptr if the handle is stale
+    auto GetSingleBody(SingleBodyHandle handle) const -> SingleBody*;
+
+    /// \brief Returns the single body at given index
+    ///
+    /// \param[in] index The index of the single body we want to retrieve
+    auto GetSingleBodyByIndex(size_t index) -> SingleBody::ptr;
+
+    /// \brief Sends the state of all single bodies in the state store to the
+    /// backend
+    ///
+    /// Each body still sends its state through its own adapter. A bulk path
+    /// (one sweep over the arrays of the store) needs array setters in each
+    /// backend's simulation adapter, so it's left for when a backend needs it
+    auto PushBodyStates() -> void;
+
+    /// Returns the current number of single bodies in this scenario
+    auto num_single_bodies() const -> size_t;
+
+    /// \brief Adds a given standalone collider to the scenario
+    ///
+    /// \param[in] collider The collider we want to add to the scenario
+    /// \return The handle used to refer to the collider from now on
+    auto AddCollider(SingleBodyCollider::ptr collider) -> ColliderHandle;
+
+    /// \brief Returns the collider referred by the given handle
+    ///
+    /// \param[in] handle The handle returned when adding the collider
+    /// \return The collider, or nullptr if the handle is stale
+    auto GetCollider(ColliderHandle handle) const -> SingleBodyCollider*;
+
+    /// Returns the current number of standalone colliders in this scenario
+    auto num_colliders() const -> size_t;
+
+    /// Returns the store that keeps the state of all bodies in this scenario
+    auto body_states() const -> BodyStateStore::ptr { return m_BodyStates; }
+
     /// Returns a string representation of this scenario
     auto ToString() const -> std::string;
 
  protected:
-    /// The list of free drawables hold by this scenario
-    std::vector<Drawable::ptr> m_Drawables;
+    /// The registry of free drawables hold by this scenario
+    ObjectRegistry<Drawable> m_Drawables;
+
+    /// The keymap used to link drawables by name to their handles
+    std::unordered_map<std::string, DrawableHandle> m_DrawablesKeymap;
+
+    /// The set of drawables (by slot index) with changes pending to be synced
+    DirtyBitset::ptr m_DirtyDrawables = nullptr;
+
+    /// The registry of single bodies hold by this scenario
+    ObjectRegistry<SingleBody> m_SingleBodies;
+
+    /// The registry of standalone colliders hold by this scenario
+    ObjectRegistry<SingleBodyCollider> m_Colliders;
 
-    /// The keympa used to link drawables by name to its location in the list
-    std::unordered_map<std::string, size_t> m_DrawablesKeymap;
+    /// The structure-of-arrays store with the state of all single bodies
+    BodyStateStore::ptr m_BodyStates = nullptr;
 };
 
 }  // namespace core
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace loco {
+
+/// \brief Reference-counted buffer of elements, shared on copy
+///
+/// Copying a buffer only copies a reference to its storage (no allocations
+/// nor memcpy), so the same mesh or heightfield data used by many objects
+/// lives in memory only once. The contents are accessed read-only through
+/// get() and operator[]; writing goes through mutable_data(), which first
+/// makes a private copy of the storage if it's shared with other buffers
+/// (copy-on-write), so changes never leak into other copies.
+///
+/// Thread safety: same as std::shared_ptr. Buffers sharing storage can be read
+/// and copied concurrently, but a buffer being written must not be accessed
+/// concurrently from other threads.
+template <typename T>
+class SharedBuffer {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "SharedBuffer only supports trivially copyable elements");
+
+ public:
+    /// Creates an empty buffer (compares equal to nullptr)
+    SharedBuffer() = default;
+
+    /// Creates an empty buffer (allows resetting buffers with nullptr)
+    SharedBuffer(std::nullptr_t /*null*/) {}  // NOLINT
+
+    /// \brief Creates a buffer with the given number of zeroed elements
+    ///
+    /// \param[in] size The number of elements of the buffer
+    explicit SharedBuffer(size_t size)
+        : m_Data(_Allocate(size)), m_Size(size) {}
+
+    /// \brief Creates a buffer with a copy of the given elements
+    ///
+    /// \param[in] data The elements to be copied into the buffer
+    /// \param[in] size The number of elements to be copied
+    SharedBuffer(const T* data, size_t size)
+        : m_Data(_Allocate(size)), m_Size(size) {
+        if (data != nullptr && size > 0) {
+            memcpy(m_Data.get(), data, sizeof(T) * size);
+        }
+    }
+
+    /// \brief Creates a buffer that takes ownership of the given storage
+    ///
+    /// \param[in] data The storage to be owned by the buffer
+    /// \param[in] size The number of elements in the given storage
+    SharedBuffer(std::unique_ptr<T[]> data, size_t size)  // NOLINT
+        : m_Data(data.release(), std::default_delete<T[]>()), m_Size(size) {}
+
+    /// \brief Creates a buffer over storage owned by someone else
+    ///
+    /// Useful for storage that isn't allocated with new[] (e.g. a memory-mapped
+    /// file), using the aliasing constructor of std::shared_ptr to keep the
+    /// actual owner alive while the buffer (or any copy of it) exists.
+    ///
+    /// \param[in] data Pointer to the elements, sharing ownership of them
+    /// \param[in] size The number of elements in the given storage
+    SharedBuffer(std::shared_ptr<T> data, size_t size)
+        : m_Data(std::move(data)), m_Size(size) {}
+
+    /// Creates a buffer that shares the storage of the given buffer
+    SharedBuffer(const SharedBuffer<T>& other) = default;
+
+    /// Makes this buffer share the storage of the given buffer
+    auto operator=(const SharedBuffer<T>& other) -> SharedBuffer<T>& = default;
+
+    /// Takes the storage of the given buffer (which is left empty)
+    SharedBuffer(SharedBuffer<T>&& other) noexcept
+        : m_Data(std::move(other.m_Data)), m_Size(other.m_Size) {
+        other.m_Size = 0;
+    }
+
+    /// Takes the storage of the given buffer (which is left empty)
+    auto operator=(SharedBuffer<T>&& other) noexcept -> SharedBuffer<T>& {
+        if (this != &other) {
+            m_Data = std::move(other.m_Data);
+            m_Size = other.m_Size;
+            other.m_Size = 0;
+        }
+        return *this;
+    }
+
+    ~SharedBuffer() = default;
+
+    /// Returns a read-only pointer to the elements (nullptr if empty)
+    auto get() const -> const T* { return m_Data.get(); }
+
+    /// Returns the element at the given index (no bounds checking)
+    auto operator[](size_t index) const -> const T& {
+        return m_Data.get()[index];
+    }
+
+    /// \brief Returns a writable pointer to the elements
+    ///
+    /// If the storage is shared with other buffers, it's copied first, so the
+    /// pointer refers to storage owned only by this buffer
+    auto mutable_data() -> T* {
+        if (m_Data != nullptr && m_Data.use_count() > 1) {
+            auto data = _Allocate(m_Size);
+            memcpy(data.get(), m_Data.get(), sizeof(T) * m_Size);
+            m_Data = std::move(data);
+        }
+        return m_Data.get();
+    }
+
+    /// Returns the number of elements in this buffer
+    auto size() const -> size_t { return m_Size; }
+
+    /// Returns the number of buffers sharing this storage (0 if empty)
+    auto use_count() const -> long { return m_Data.use_count(); }  // NOLINT
+
+    /// Returns a weak reference to the storage (doesn't keep it alive)
+    auto weak() const -> std::weak_ptr<T> { return m_Data; }
+
+    /// Returns whether or not this buffer has storage
+    explicit operator bool() const { return m_Data != nullptr; }
+
+    auto operator==(std::nullptr_t /*null*/) const -> bool {
+        return m_Data == nullptr;
+    }
+
+    auto operator!=(std::nullptr_t /*null*/) const -> bool {
+        return m_Data != nullptr;
+    }
+
+ private:
+    /// Allocates zeroed storage for the given number of elements
+    static auto _Allocate(size_t size) -> std::shared_ptr<T> {
+        if (size == 0) {
+            return nullptr;
+        }
+        // NOLINTNEXTLINE
+        return std::shared_ptr<T>(new T[size](), std::default_delete<T[]>());
+    }
+
+ private:
+    /// The (possibly shared) storage of the elements
+    std::shared_ptr<T> m_Data = nullptr;
+
+    /// The number of elements in the storage
+    size_t m_Size = 0;
+};
+
+}  // namespace loco
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "./common.hpp"
+#include "./scenario_t.hpp"
+#include "./simulation_t.hpp"
+#include "./thread_pool_t.hpp"
+
+namespace loco {
+namespace core {
+
+/// \brief Batch of independent simulations that are stepped as a single unit
+///
+/// A batch owns N scenarios (one per environment) and a simulation for each
+/// of them, all of them using the same physics backend. Observations of every
+/// environment are written into a single contiguous buffer of shape
+/// (num_envs, obs_dim) in row-major order, so that consumers (e.g. a python
+/// training loop) can access all of them at once without extra copies.
+///
+/// If a thread pool is given, the simulations are stepped and reset in
+/// parallel (they don't share any state). Observations are always collected
+/// from the calling thread, as the observation callback might not be safe to
+/// call concurrently (e.g. when it's a Python function).
+///
+/// Thread safety: the batch itself must be driven from a single thread.
+class SimulationBatch {
+    // cppcheck-suppress unknownMacro
+    NO_COPY_NO_MOVE_NO_ASSIGN(SimulationBatch)
+
+    DEFINE_SMART_POINTERS(SimulationBatch)
+
+ public:
+    /// Callable used to create the scenario for the environment at an index
+    using ScenarioFactory = std::function<Scenario::ptr(size_t env_index)>;
+
+    /// Callable used to write the observation of a single environment
+    using ObservationFn = std::function<void(
+        size_t env_index, const Simulation& simulation, Scalar* observation)>;
+
+    /// \brief Creates a batch of simulations from the given scenario factory
+    ///
+    /// \param[in] num_envs The number of environments in this batch
+    /// \param[in] factory The callable used to create each scenario
+    /// \param[in] backend_type The physics backend used by all environments
+    explicit SimulationBatch(size_t num_envs, const ScenarioFactory& factory,
+                             eBackendType backend_type);
+
+    /// Releases/Frees all allocated resources of this batch
+    ~SimulationBatch() = default;
+
+    /// Initializes all simulations in the batch
+    auto Init() -> void;
+
+    /// Advances all simulations by the given amount of time
+    auto StepAll(Scalar step) -> void;
+
+    /// Resets all simulations to their initial configuration
+    auto ResetAll() -> void;
+
+    /// \brief Resets only the simulations flagged in the given mask
+    ///
+    /// \param[in] mask One flag per environment, true if it should be reset
+    auto ResetSome(const std::vector<bool>& mask) -> void;
+
+    /// \brief Sets the function used to extract the observation of each env.
+    ///
+    /// \param[in] obs_dim The number of scalars in a single observation
+    /// \param[in] obs_fn The callable that writes a single observation
+    auto SetObservationFn(size_t obs_dim, ObservationFn obs_fn) -> void;
+
+    /// Writes the observations of all environments into the shared buffer
+    auto CollectObservations() -> void;
+
+    /// Sets the timestep of all simulations in the batch
+    auto SetTimeStep(Scalar step) -> void;
+
+    /// Sets the gravity of all simulations in the batch
+    auto SetGravity(const Vec3& gravity) -> void;
+
+    /// \brief Sets the thread pool used to step the simulations in parallel
+    ///
+    /// \param[in] pool The pool to dispatch to (nullptr runs sequentially)
+    auto SetThreadPool(ThreadPool::ptr pool) -> void;
+
+    /// Returns the thread pool used by this batch (nullptr if sequential)
+    auto thread_pool() const -> ThreadPool::ptr { return m_ThreadPool; }
+
+    /// Returns the number of environments in this batch
+    auto num_envs() const -> size_t { return m_Simulations.size(); }
+
+    /// Returns the number of scalars in the observation of a single env.
+    auto obs_dim() const -> size_t { return m_ObsDim; }
+
+    /// Returns the type of backend used for all simulations in the batch
+    auto backend_type() const -> eBackendType { return m_BackendType; }
+
+    /// Returns a mutable pointer to the (num_envs, obs_dim) observations
+    auto observations() -> Scalar* { return m_Observations.data(); }
+
+    /// Returns an unmutable pointer to the (num_envs, obs_dim) observations
+    auto observations() const -> const Scalar* {
+        return m_Observations.data();
+    }
+
+    /// Returns a mutable reference to the simulation at the given index
+    auto simulation(size_t env_index) -> Simulation&;
+
+    /// Returns an unmutable reference to the simulation at the given index
+    auto simulation(size_t env_index) const -> const Simulation&;
+
+    /// Returns the scenario of the environment at the given index
+    auto scenario(size_t env_index) const -> Scenario::ptr;
+
+    /// Returns a string representation of this batch
+    auto ToString() const -> std::string;
+
+ protected:
+    /// Writes the observation of a single environment into the buffer
+    auto _CollectObservation(size_t env_index) -> void;
+
+    /// Runs fn(i) for each environment, in parallel if we have a thread pool
+    auto _ForEachEnv(const std::function<void(size_t)>& fn) -> void;
+
+ protected:
+    /// The type of backend being used for all simulations in the batch
+    eBackendType m_BackendType = eBackendType::NONE;
+
+    /// The scenarios simulated by each environment
+    std::vector<Scenario::ptr> m_Scenarios;
+
+    /// The simulations (one per environment) owned by this batch
+    std::vector<Simulation::uptr> m_Simulations;
+
+    /// Number of scalars in the observation of a single environment
+    size_t m_ObsDim = 0;
+
+    /// Callable used to extract the observation of a single environment
+    ObservationFn m_ObsFn = nullptr;
+
+    /// Contiguous buffer of shape (num_envs, obs_dim) with all observations
+    std::vector<Scalar> m_Observations;
+
+    /// Executor used to step the simulations in parallel (if given)
+    ThreadPool::ptr m_ThreadPool = nullptr;
+};
+
+}  // namespace core
+}  // namespace loco
@@ -1,16 +1,24 @@
 #pragma once
 
+#include <future>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "./common.hpp"
 #include "./scenario_t.hpp"
+#include "./thread_pool_t.hpp"
 #include "./impl/simulation_impl.hpp"
 
 namespace loco {
 namespace core {
 
-/// Core simulation object, used to interact with the simulation itself
+/// \brief Core simulation object, used to interact with the simulation itself
+///
+/// Thread safety: a simulation is not safe to use from several threads at the
+/// same time, except for Poll(). Different simulations don't share any state,
+/// so they can be stepped concurrently (that's what SimulationBatch does).
+/// Methods that modify the simulation wait for any pending StepAsync() first.
 class Simulation {
     // cppcheck-suppress unknownMacro
     NO_COPY_NO_MOVE_NO_ASSIGN(Simulation)
@@ -18,12 +26,22 @@ class Simulation {
     DEFINE_SMART_POINTERS(Simulation)
 
  public:
-    /// Creates a simulation for the given scenario
-    explicit Simulation(Scenario::ptr scenario, eBackendType backend_type)
-        : m_Scenario(std::move(scenario)), m_BackendType(backend_type) {}
+    /// Waitable handle to a simulation step running asynchronously
+    using StepHandle = std::shared_future<void>;
+
+    /// \brief Creates a simulation for the given scenario
+    ///
+    /// \param[in] scenario The scenario to be simulated
+    /// \param[in] backend_type The physics backend used for the simulation
+    /// \param[in] config Options used to configure the physics backend
+    explicit Simulation(Scenario::ptr scenario, eBackendType backend_type,
+                        SimulationConfig config = SimulationConfig())
+        : m_Scenario(std::move(scenario)),
+          m_BackendType(backend_type),
+          m_Config(config) {}
 
     /// Releases/Frees all allocated resources of this simulation
-    ~Simulation() = default;
+    ~Simulation();
 
     /// Initializes the internal backend and sets the simulation ready
     auto Init() -> void;
@@ -34,6 +52,55 @@ class Simulation {
     /// Advances the simulation by the given amount of time
     auto Step(Scalar step) -> void;
 
+    /// \brief Advances the simulation in the background by the given time
+    ///
+    /// Returns right away, so the caller can do other work (e.g. run the
+    /// policy for the next action) while the physics step is running. Any
+    /// other call to this simulation waits first for the pending step.
+    ///
+    /// \param[in] step The amount of time to advance the simulation
+    /// \return A handle that can be used to wait for this step to finish
+    auto StepAsync(Scalar step) -> StepHandle;
+
+    /// Blocks until the pending asynchronous step (if any) has finished
+    auto Wait() -> void;
+
+    /// Returns whether or not there's no asynchronous step still running
+    auto Poll() const -> bool;
+
+    /// \brief Sets the thread pool used to run the asynchronous steps
+    ///
+    /// \param[in] pool The pool to run on (nullptr uses a private worker)
+    auto SetThreadPool(ThreadPool::ptr pool) -> void;
+
+    /// \brief Writes a snapshot of the full physics state into the buffer
+    ///
+    /// \param[out] buffer Preallocated buffer of at least state_size() bytes
+    /// \param[in] buffer_size The size in bytes of the given buffer
+    auto SaveState(uint8_t* buffer, size_t buffer_size) -> void;
+
+    /// \brief Writes a snapshot of the full physics state into the buffer
+    ///
+    /// The buffer is only resized if it's not large enough, so reusing the
+    /// same buffer for several snapshots doesn't allocate
+    ///
+    /// \param[out] buffer The buffer where to store the snapshot
+    auto SaveState(std::vector<uint8_t>& buffer) -> void;
+
+    /// \brief Restores the full physics state from the given snapshot
+    ///
+    /// \param[in] buffer Buffer with a snapshot written by SaveState
+    /// \param[in] buffer_size The size in bytes of the given buffer
+    auto LoadState(const uint8_t* buffer, size_t buffer_size) -> void;
+
+    /// \brief Restores the full physics state from the given snapshot
+    ///
+    /// \param[in] buffer Buffer with a snapshot written by SaveState
+    auto LoadState(const std::vector<uint8_t>& buffer) -> void;
+
+    /// Returns the number of bytes required to store a state snapshot
+    auto state_size() const -> size_t;
+
     /// Sets the timestep of the simulation
     auto SetTimeStep(Scalar step) -> void;
 
@@ -49,6 +116,15 @@ class Simulation {
     /// Returns the type of backend used internally for the simulation
     auto backend_type() const -> eBackendType { return m_BackendType; }
 
+    /// Returns the options used to configure the physics backend
+    auto config() const -> const SimulationConfig& { return m_Config; }
+
+    /// \brief Returns the performance counters of the last step
+    ///
+    /// The counters are kept by the backend and updated in place on each step,
+    /// so reading them doesn't allocate. Must be initialized first
+    auto stats() const -> const SimulationStats&;
+
     /// Returns a mutable reference to the internal pimpl
     auto impl() -> SimulationImpl&;
 
@@ -56,12 +132,18 @@ class Simulation {
     auto impl() const -> const SimulationImpl&;
 
  protected:
+    /// Steps the backend, updating the generic counters of its stats
+    auto _StepBackend(Scalar step) -> void;
+
     /// Scenario to be simulated
     Scenario::ptr m_Scenario = nullptr;
 
     /// The type of backend being used for this physics simulation
     eBackendType m_BackendType = eBackendType::NONE;
 
+    /// The options used to configure the physics backend
+    SimulationConfig m_Config;
+
     /// The value of gravity on this simulation
     Vec3 m_Gravity = {ToScalar(0.0), ToScalar(0.0), ToScalar(-9.81)};
 
@@ -70,6 +152,12 @@ class Simulation {
 
     /// Backend-specific interface to the physics engine
     SimulationImpl::uptr m_BackendImpl = nullptr;
+
+    /// Executor used to run the asynchronous steps
+    ThreadPool::ptr m_ThreadPool = nullptr;
+
+    /// Handle to the asynchronous step that's currently running (if any)
+    StepHandle m_PendingStep;
 };
 
 }  // namespace core
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <loco/core/common.hpp>
+
+namespace loco {
+namespace core {
+
+/// \brief Structure-of-arrays storage for the dynamic state of rigid bodies
+///
+/// Each field of the state (position, orientation, velocities, etc.) is kept
+/// in its own contiguous array, with one entry per body. This way, syncing
+/// with the backend or extracting observations for all bodies becomes a
+/// linear sweep over memory, instead of chasing pointers across the heap.
+///
+/// The arrays are stored in row-major order, and each entry of a field has a
+/// fixed number of scalars (e.g. 3 for positions). Orientations are stored as
+/// quaternions in (w, x, y, z) order.
+///
+/// The arrays are allocated once for the capacity given at construction, and
+/// never move, so pointers to them (e.g. NumPy views) stay valid for as long
+/// as the store lives. Released slots are reset to rest and reused by the next
+/// allocations, so the arrays can have holes (at rest, with no forces).
+///
+/// Thread safety: different bodies can be read and written concurrently, but
+/// Allocate() and Release() must not run concurrently with each other.
+class BodyStateStore {
+    // cppcheck-suppress unknownMacro
+    NO_COPY_NO_MOVE_NO_ASSIGN(BodyStateStore)
+
+    DEFINE_SMART_POINTERS(BodyStateStore)
+
+ public:
+    /// Number of scalars used to store a position (xyz)
+    static constexpr size_t DIM_POSITION = 3;
+    /// Number of scalars used to store an orientation (wxyz)
+    static constexpr size_t DIM_ORIENTATION = 4;
+    /// Number of scalars used to store a velocity, force or torque (xyz)
+    static constexpr size_t DIM_VEC3 = 3;
+
+    /// Number of bodies a store has room for, unless given otherwise
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+    /// \brief Creates an empty store with room for the given number of bodies
+    ///
+    /// \param[in] capacity The maximum number of bodies in the store
+    explicit BodyStateStore(size_t capacity = DEFAULT_CAPACITY);
+
+    /// Releases all allocated resources of this store
+    ~BodyStateStore() = default;
+
+    /// \brief Takes a slot for the state of a new body (at rest, at the origin)
+    ///
+    /// Slots released before are reused first. Throws a std::runtime_error if
+    /// all slots are taken (the arrays never grow, see the class docs)
+    ///
+    /// \return The index of the new body's state in this store
+    auto Allocate() -> size_t;
+
+    /// \brief Gives back the slot at the given index, to be reused later
+    ///
+    /// \param[in] index The index returned by Allocate() for the body
+    auto Release(size_t index) -> void;
+
+    /// Sets the forces and torques of all bodies to zero
+    auto ClearForces() -> void;
+
+    /// Returns the position of the body at the given index
+    auto GetPosition(size_t index) const -> Vec3;
+
+    /// Returns the orientation of the body at the given index
+    auto GetOrientation(size_t index) const -> Quat;
+
+    /// Returns the pose of the body at the given index
+    auto GetPose(size_t index) const -> Pose;
+
+    /// Returns the linear velocity of the body at the given index
+    auto GetLinearVel(size_t index) const -> Vec3;
+
+    /// Returns the angular velocity of the body at the given index
+    auto GetAngularVel(size_t index) const -> Vec3;
+
+    /// Returns the force applied at the COM of the body at the given index
+    auto GetForce(size_t index) const -> Vec3;
+
+    /// Returns the torque applied to the body at the given index
+    auto GetTorque(size_t index) const -> Vec3;
+
+    /// Sets the position of the body at the given index
+    auto SetPosition(size_t index, const Vec3& position) -> void;
+
+    /// Sets the orientation of the body at the given index
+    auto SetOrientation(size_t index, const Quat& orientation) -> void;
+
+    /// Sets the pose of the body at the given index
+    auto SetPose(size_t index, const Pose& pose) -> void;
+
+    /// Sets the linear velocity of the body at the given index
+    auto SetLinearVel(size_t index, const Vec3& linear_vel) -> void;
+
+    /// Sets the angular velocity of the body at the given index
+    auto SetAngularVel(size_t index, const Vec3& angular_vel) -> void;
+
+    /// Sets the force applied at the COM of the body at the given index
+    auto SetForce(size_t index, const Vec3& force) -> void;
+
+    /// Sets the torque applied to the body at the given index
+    auto SetTorque(size_t index, const Vec3& torque) -> void;
+
+    /// Returns the number of rows in use of the arrays (including holes)
+    auto size() const -> size_t { return m_Size; }
+
+    /// Returns the number of bodies whose state is kept in this store
+    auto num_bodies() const -> size_t { return m_Size - m_FreeSlots.size(); }
+
+    /// Returns the maximum number of bodies this store has room for
+    auto capacity() const -> size_t { return m_Capacity; }
+
+    /// Returns the (size, 3) array of positions
+    auto positions() -> Scalar* { return m_Positions.data(); }
+
+    /// Returns the (size, 3) array of positions
+    auto positions() const -> const Scalar* { return m_Positions.data(); }
+
+    /// Returns the (size, 4) array of orientations
+    auto orientations() -> Scalar* { return m_Orientations.data(); }
+
+    /// Returns the (size, 4) array of orientations
+    auto orientations() const -> const Scalar* {
+        return m_Orientations.data();
+    }
+
+    /// Returns the (size, 3) array of linear velocities
+    auto linear_vels() -> Scalar* { return m_LinearVels.data(); }
+
+    /// Returns the (size, 3) array of linear velocities
+    auto linear_vels() const -> const Scalar* { return m_LinearVels.data(); }
+
+    /// Returns the (size, 3) array of angular velocities
+    auto angular_vels() -> Scalar* { return m_AngularVels.data(); }
+
+    /// Returns the (size, 3) array of angular velocities
+    auto angular_vels() const -> const Scalar* { return m_AngularVels.data(); }
+
+    /// Returns the (size, 3) array of forces applied at each COM
+    auto forces() -> Scalar* { return m_Forces.data(); }
+
+    /// Returns the (size, 3) array of forces applied at each COM
+    auto forces() const -> const Scalar* { return m_Forces.data(); }
+
+    /// Returns the (size, 3) array of torques applied to each body
+    auto torques() -> Scalar* { return m_Torques.data(); }
+
+    /// Returns the (size, 3) array of torques applied to each body
+    auto torques() const -> const Scalar* { return m_Torques.data(); }
+
+    /// Returns a string representation of this store
+    auto ToString() const -> std::string;
+
+ protected:
+    /// Resets the state at the given index to rest, at the origin
+    auto _ResetSlot(size_t index) -> void;
+
+ protected:
+    /// The maximum number of bodies (rows allocated for each array)
+    size_t m_Capacity = 0;
+
+    /// The number of rows in use, including released slots
+    size_t m_Size = 0;
+
+    /// Released slots, to be reused by the next allocations
+    std::vector<size_t> m_FreeSlots;
+
+    /// Whether or not each slot is taken by a body
+    std::vector<bool> m_SlotTaken;
+
+    /// The positions of all bodies in world space
+    std::vector<Scalar> m_Positions;
+    /// The orientations of all bodies in world space
+    std::vector<Scalar> m_Orientations;
+    /// The linear velocities of all bodies
+    std::vector<Scalar> m_LinearVels;
+    /// The angular velocities of all bodies
+    std::vector<Scalar> m_AngularVels;
+    /// The total forces to be applied at the COM of each body
+    std::vector<Scalar> m_Forces;
+    /// The total torques to be applied to each body
+    std::vector<Scalar> m_Torques;
+};
+
+}  // namespace core
+}  // namespace loco
@@ -50,6 +50,14 @@ class ISingleBodyColliderImpl {
                                      size_t n_depth_samples,
                                      const Scalar* ptr_heights) -> void = 0;
 
+    /// \brief Updates a region of the elevation data of the hfield collider
+    ///
+    /// \param[in] region The region of the heightfield that changed
+    /// \param[in] ptr_heights The new heights of the region (row-major, with
+    ///                        region.n_width_samples samples per row)
+    virtual auto ChangeElevationRegion(const HeightfieldRegion& region,
+                                       const Scalar* ptr_heights) -> void = 0;
+
     /// \brief Updates the collision group of this collider in simulation
     ///
     /// \param[in] col_group The collision group given by the user
@@ -86,6 +94,10 @@ class SingleBodyColliderImplNone : public ISingleBodyColliderImpl {
     auto ChangeElevationData(size_t n_width_samples, size_t n_depth_samples,
                              const Scalar* ptr_heights) -> void override {}
 
+    // Documentation inherited
+    auto ChangeElevationRegion(const HeightfieldRegion& region,
+                               const Scalar* ptr_heights) -> void override {}
+
     // Documentation inherited
     auto ChangeCollisionGroup(int32_t col_group) -> void override {}
 
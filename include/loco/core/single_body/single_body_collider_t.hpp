@@ -3,6 +3,7 @@
 #include <utility>
 
 #include <loco/core/common.hpp>
+#include <loco/core/asset_cache_t.hpp>
 #include <loco/core/single_body/impl/single_body_collider_impl.hpp>
 
 namespace loco {
@@ -17,9 +18,15 @@ class SingleBodyCollider {
  public:
     /// \brief Creates a single body collider using the given configuration
     ///
+    /// Meshes loaded from files are shared with identical ones used by other
+    /// objects through the AssetCache (see asset_key()). The buffers of
+    /// procedural meshes and heightfields can still be deduplicated by calling
+    /// AssetCache::Share() on the given data beforehand
+    ///
     /// \param[in] data Collider data to be used to create this collider
     explicit SingleBodyCollider(::loco::ColliderData data)
-        : m_Data(std::move(data)) {}
+        : m_Data(std::move(data)),
+          m_AssetKey(AssetCache::ShareIfLoaded(m_Data)) {}
 
     /// \brief Releases all allocated resources for this collider
     ~SingleBodyCollider() = default;
@@ -46,6 +53,17 @@ class SingleBodyCollider {
     auto ChangeElevationData(size_t n_width_samples, size_t n_depth_samples,
                              const Scalar* ptr_heights) -> void;
 
+    /// \brief Changes a region of the elevation data of the hfield collider
+    ///
+    /// Only the given region is written and sent to the backend, so editing
+    /// terrain (e.g. deformable or procedural) costs O(region), not O(grid)
+    ///
+    /// \param[in] region The region of the heightfield to be changed
+    /// \param[in] ptr_heights The new heights of the region (row-major, with
+    ///                        region.n_width_samples samples per row)
+    auto ChangeElevationRegion(const HeightfieldRegion& region,
+                               const Scalar* ptr_heights) -> void;
+
     /// \brief Changes the collision group of this collider
     ///
     /// \param[in] col_group The collision group given by the user
@@ -71,10 +89,20 @@ class SingleBodyCollider {
     /// \brief Returns an mutable reference to the config data of the collider
     auto data() const -> const ColliderData& { return m_Data; }
 
+    /// \brief Returns the key of the mesh or hfield asset in the AssetCache
+    ///
+    /// Backends can use it to cache the geometry built for this collider. It's
+    /// 0 for other shapes, for meshes that weren't loaded from files, and after
+    /// the mesh or hfield data is changed
+    auto asset_key() const -> AssetCache::Key { return m_AssetKey; }
+
  protected:
     /// The configuration data for this collider
     ::loco::ColliderData m_Data;
 
+    /// The key of the asset of this collider in the AssetCache (0 if none)
+    AssetCache::Key m_AssetKey = 0;
+
     /// The backend type used for simulating this single body collider
     eBackendType m_BackendType = eBackendType::NONE;
     /// The adapter used to interact with the internal physics backend
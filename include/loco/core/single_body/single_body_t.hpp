@@ -5,6 +5,7 @@
 #include <utility>
 
 #include <loco/core/common.hpp>
+#include <loco/core/single_body/body_state_store_t.hpp>
 #include <loco/core/single_body/impl/single_body_impl.hpp>
 
 namespace loco {
@@ -20,8 +21,7 @@ class SingleBody {
     /// \brief Creates a single body using the given configuration
     ///
     /// \param[in] data Body data to be used to create and configure this body
-    explicit SingleBody(::loco::BodyData data, const Pose& p_pose)
-        : m_Data(std::move(data)), m_Pose(p_pose) {}
+    explicit SingleBody(::loco::BodyData data, const Pose& p_pose);
 
     /// \brief Creates a body using the given configuration
     ///
@@ -29,11 +29,10 @@ class SingleBody {
     /// \param[in] p_position The position of this body in world space
     /// \param[in] p_orientation The orientation of this body in world space
     explicit SingleBody(::loco::BodyData data, const Vec3& p_position,
-                        const Quat& p_orientation = Quat(1.0, 0.0, 0.0, 0.0))
-        : m_Data(std::move(data)), m_Pose(Pose(p_position, p_orientation)) {}
+                        const Quat& p_orientation = Quat(1.0, 0.0, 0.0, 0.0));
 
-    /// \brief Deletes all allocated resources
-    ~SingleBody() = default;
+    /// \brief Deletes all allocated resources (and frees our state slot)
+    ~SingleBody();
 
     /// \brief Initializes this body's internal resources
     ///
@@ -45,6 +44,16 @@ class SingleBody {
     /// \param[in] adapter The adapter to be used by this body
     auto SetAdapter(ISingleBodyImpl::uptr adapter) -> void;
 
+    /// \brief Moves the state of this body into the given shared store
+    ///
+    /// Bodies keep their state inline until they're moved into the store of
+    /// the scenario they're added to (so creating a body allocates no store),
+    /// keeping their current state. If the body was already in another store,
+    /// its slot there is released, to be reused by others
+    ///
+    /// \param[in] store The store that will keep the state of this body
+    auto SetStateStore(BodyStateStore::ptr store) -> void;
+
     /// \brief Resets the body to its default/zero configuration
     auto Reset() -> void;
 
@@ -73,20 +82,71 @@ class SingleBody {
     /// \param[in] angular_vel The angular velocity of this body
     auto SetAngularVelocity(const Vec3& angular_vel) -> void;
 
+    /// \brief Sends the state kept in the state store to the backend
+    ///
+    /// Use this after writing into the arrays of the state store directly
+    /// (e.g. through the NumPy views exposed by the Python bindings)
+    auto PushState() -> void;
+
+    /// \brief Sets the total force to be applied at the COM of this body
+    ///
+    /// \param[in] force The total force applied at the center of mass
+    auto SetTotalForceCOM(const Vec3& force) -> void;
+
+    /// \brief Sets the total torque to be applied to this body
+    ///
+    /// \param[in] torque The total torque applied to this body
+    auto SetTotalTorque(const Vec3& torque) -> void;
+
     /// \brief Returns the current pose of this rigid body in world space
-    auto pose() const -> Pose { return m_Pose; }
+    auto pose() const -> Pose {
+        return (m_States != nullptr) ? m_States->GetPose(m_StateIndex)
+                                     : m_LocalState.pose;
+    }
 
     /// \brief Returns the current position of this rigid body in world space
-    auto position() const -> Vec3 { return m_Pose.position; }
+    auto position() const -> Vec3 {
+        return (m_States != nullptr) ? m_States->GetPosition(m_StateIndex)
+                                     : m_LocalState.pose.position;
+    }
 
     /// \brief Returns the current orientation of this rigid body in world space
-    auto orientation() const -> Quat { return m_Pose.orientation; }
+    auto orientation() const -> Quat {
+        return (m_States != nullptr) ? m_States->GetOrientation(m_StateIndex)
+                                     : m_LocalState.pose.orientation;
+    }
 
     /// \brief Returns the linear velocity of this rigid body
-    auto linear_vel() const -> Vec3 { return m_LinearVel; }
+    auto linear_vel() const -> Vec3 {
+        return (m_States != nullptr) ? m_States->GetLinearVel(m_StateIndex)
+                                     : m_LocalState.linear_vel;
+    }
 
     /// \brief Returns the angular velocity of this rigid body
-    auto angular_vel() const -> Vec3 { return m_AngularVel; }
+    auto angular_vel() const -> Vec3 {
+        return (m_States != nullptr) ? m_States->GetAngularVel(m_StateIndex)
+                                     : m_LocalState.angular_vel;
+    }
+
+    /// \brief Returns the total force to be applied at the COM of this body
+    auto total_force_com() const -> Vec3 {
+        return (m_States != nullptr) ? m_States->GetForce(m_StateIndex)
+                                     : m_LocalState.force;
+    }
+
+    /// \brief Returns the total torque to be applied to this body
+    auto total_torque() const -> Vec3 {
+        return (m_States != nullptr) ? m_States->GetTorque(m_StateIndex)
+                                     : m_LocalState.torque;
+    }
+
+    /// \brief Returns the store that keeps the state of this body (nullptr if
+    /// the body isn't in a store yet, see SetStateStore)
+    auto state_store() const -> BodyStateStore::ptr { return m_States; }
+
+    /// \brief Returns the index of this body's state in its state store (only
+    /// meaningful once the body is in a store)
+    auto state_index() const -> size_t { return m_StateIndex; }
 
     /// \brief Returns a mutable reference to the interface to the backend
     auto impl() -> ISingleBodyImpl&;
@@ -110,21 +170,30 @@ class SingleBody {
     /// The initial angular velocity of this rigid body
     Vec3 angularVel0;
 
-    /// The total force to be applied at the COM of this rigid body
-    Vec3 totalForceCOM;
-    /// The total torque to be applied at this rigid body
-    Vec3 totalTorque;
-
  protected:
     /// The configuration data for this body
     ::loco::BodyData m_Data;
 
-    /// The current pose of this rigid body in world space
-    Pose m_Pose;
-    /// The current linear velocity of this rigid body
-    Vec3 m_LinearVel;
-    /// The current angular velocity of this rigid body
-    Vec3 m_AngularVel;
+    /// The state of a body that isn't in a state store yet
+    struct LocalState {
+        /// The pose of the body in world space
+        Pose pose;
+        /// The linear velocity of the body
+        Vec3 linear_vel;
+        /// The angular velocity of the body
+        Vec3 angular_vel;
+        /// The total force applied at the COM of the body
+        Vec3 force;
+        /// The total torque applied to the body
+        Vec3 torque;
+    };
+
+    /// The state of this body until it's moved into a state store
+    LocalState m_LocalState;
+    /// The store that keeps the current state of this body (pose, vel., etc.)
+    BodyStateStore::ptr m_States = nullptr;
+    /// The index of this body's state in the state store
+    size_t m_StateIndex = 0;
 
     /// The backend type used for simulating this body
     eBackendType m_BackendType = eBackendType::NONE;
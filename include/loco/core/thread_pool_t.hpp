@@ -0,0 +1,136 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "./common.hpp"
+
+namespace loco {
+namespace core {
+
+/// \brief Work-stealing executor used to run independent jobs concurrently
+///
+/// Each worker owns a queue of tasks. Workers pop tasks from the back of their
+/// own queue, and when it runs dry they steal from the front of the queues of
+/// the other workers, which keeps all cores busy even if the jobs take uneven
+/// amounts of time (e.g. simulations with different numbers of contacts).
+class ThreadPool {
+    // cppcheck-suppress unknownMacro
+    NO_COPY_NO_MOVE_NO_ASSIGN(ThreadPool)
+
+    DEFINE_SMART_POINTERS(ThreadPool)
+
+ public:
+    /// Callable that represents a single unit of work
+    using Task = std::function<void()>;
+
+    /// \brief Creates a pool with the given number of worker threads
+    ///
+    /// \param[in] num_workers Number of workers (0 uses all hardware threads)
+    /// \param[in] pin_to_cores Whether or not to pin each worker to a core
+    ///                         (one of the cores this process may run on)
+    explicit ThreadPool(size_t num_workers = 0, bool pin_to_cores = false);
+
+    /// Waits for all pending tasks and joins all worker threads
+    ~ThreadPool();
+
+    /// \brief Queues the given task to be run by any of the workers
+    ///
+    /// \param[in] task The task to be executed asynchronously
+    auto Submit(Task task) -> void;
+
+    /// \brief Runs fn(i) for every i in [0, count), blocking until all finish
+    ///
+    /// The calling thread also executes pending tasks while it waits, so it's
+    /// safe to call this method from within a task running in this same pool.
+    /// The first exception thrown by any of the jobs is rethrown here.
+    ///
+    /// \param[in] count The number of jobs to execute
+    /// \param[in] fn The job to be executed for each index
+    auto ParallelFor(size_t count, const std::function<void(size_t)>& fn)
+        -> void;
+
+    /// \brief Blocks until all submitted tasks have been executed
+    ///
+    /// The calling thread also executes pending tasks while it waits. It can't
+    /// be called from within a task of this same pool (it would wait for its
+    /// own task to finish), so it throws a std::runtime_error in that case.
+    auto WaitIdle() -> void;
+
+    /// Returns the number of worker threads of this pool
+    auto num_workers() const -> size_t { return m_Workers.size(); }
+
+    /// Returns whether or not the workers are pinned to specific cores
+    auto pinned() const -> bool { return m_PinToCores; }
+
+    /// Returns a string representation of this pool
+    auto ToString() const -> std::string;
+
+ protected:
+    /// Queue of tasks owned by a single worker
+    struct WorkQueue {
+        /// Mutex used to protect the access to the tasks in this queue
+        std::mutex mutex;
+        /// Tasks that are pending to be executed
+        std::deque<Task> tasks;
+    };
+
+    /// Main loop executed by the worker at the given index
+    auto _WorkerLoop(size_t worker_index) -> void;
+
+    /// Tries to pop a task from the back of the given worker's queue
+    auto _TryPop(size_t worker_index, Task& task) -> bool;
+
+    /// Tries to steal a task from the front of any other worker's queue
+    auto _TrySteal(size_t thief_index, Task& task) -> bool;
+
+    /// Tries to get any task, either from our own queue or by stealing one
+    auto _TryAcquire(Task& task) -> bool;
+
+    /// Executes the given task and updates the bookkeeping of the pool
+    auto _RunTask(Task& task) -> void;
+
+    /// Pins the worker at the given index to a specific core (if supported)
+    auto _PinWorker(size_t worker_index) -> void;
+
+ protected:
+    /// Whether or not the workers are pinned to specific cores
+    bool m_PinToCores = false;
+
+    /// Whether or not the workers should stop and exit their loop
+    bool m_Stop = false;
+
+    /// The queues of tasks, one per worker
+    std::vector<std::unique_ptr<WorkQueue>> m_Queues;
+
+    /// The worker threads owned by this pool
+    std::vector<std::thread> m_Workers;
+
+    /// Number of tasks that are queued and haven't been taken by any worker
+    std::atomic<size_t> m_NumQueued{0};
+
+    /// Number of tasks that have been submitted but haven't finished yet
+    std::atomic<size_t> m_NumPending{0};
+
+    /// Index of the next queue used when submitting from a non-worker thread
+    std::atomic<size_t> m_NextQueue{0};
+
+    /// Mutex used along with the condition variables to put workers to sleep
+    std::mutex m_WakeMutex;
+
+    /// Condition used to wake up workers when new tasks are available
+    std::condition_variable m_WakeCondition;
+
+    /// Condition used to notify waiters that all tasks have been executed
+    std::condition_variable m_IdleCondition;
+};
+
+}  // namespace core
+}  // namespace loco
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <utils/logging.hpp>
+
+namespace loco {
+namespace core {
+
+/// Represents a single completed scope, as recorded by a TraceScope
+struct TraceEvent {
+    /// Name of the scope (must have static storage, e.g. a string literal)
+    const char* name = nullptr;
+    /// Category of the scope (must have static storage, e.g. "loco")
+    const char* category = nullptr;
+    /// Index of the thread that recorded this event (in order of first use)
+    uint32_t thread_index = 0;
+    /// Time at which the scope was entered (nanoseconds, steady clock)
+    int64_t start_ns = 0;
+    /// Time spent inside the scope (nanoseconds)
+    int64_t duration_ns = 0;
+};
+
+/// \brief Process-wide tracing session that can be toggled at runtime
+///
+/// While a session is active, every LOCO_PROFILE_SCOPE records its name and
+/// timing into a ring buffer owned by the calling thread. Only the owning
+/// thread writes into its buffer, so recording takes no locks and no
+/// allocations (only the first scope recorded by a thread registers its
+/// buffer). When no session is active, a scope costs a single atomic load.
+///
+/// The buffers keep the latest BUFFER_CAPACITY events of each thread, so long
+/// sessions keep only their tail. The collected events can be exported in the
+/// Chrome trace-event format, which both chrome://tracing and Perfetto load.
+///
+/// Thread safety: all methods can be called from any thread. Collecting the
+/// events while the session is still active is allowed, but events recorded
+/// concurrently with the collection might be missed.
+class TraceSession {
+ public:
+    /// Number of events kept per thread (must be a power of two)
+    static constexpr size_t BUFFER_CAPACITY = 1 << 16;
+
+    /// Starts a new session (discards events from any previous session)
+    static auto Begin() -> void;
+
+    /// Stops recording events (the recorded events are kept until Begin)
+    static auto End() -> void;
+
+    /// Returns whether or not a session is currently recording events
+    static auto IsActive() -> bool;
+
+    /// Returns the current time of the clock used for the events (in ns)
+    static auto Now() -> int64_t;
+
+    /// \brief Records a completed scope into the buffer of the calling thread
+    ///
+    /// \param[in] name The name of the scope (with static storage)
+    /// \param[in] category The category of the scope (with static storage)
+    /// \param[in] start_ns The time at which the scope was entered
+    /// \param[in] end_ns The time at which the scope was exited
+    static auto Record(const char* name, const char* category,
+                       int64_t start_ns, int64_t end_ns) -> void;
+
+    /// Returns all events of the current (or last) session, sorted by start
+    static auto Collect() -> std::vector<TraceEvent>;
+
+    /// Returns the events of the current (or last) session as trace JSON
+    static auto ToChromeTrace() -> std::string;
+
+    /// \brief Writes the events of the current (or last) session to a file
+    ///
+    /// \param[in] filepath The path of the JSON file to be written
+    static auto WriteChromeTrace(const std::string& filepath) -> void;
+};
+
+/// \brief RAII helper that records the time spent in the enclosing scope
+///
+/// The scope is only recorded if a session was active when it was entered.
+/// Use it through the LOCO_PROFILE_SCOPE and LOCO_PROFILE_FUNCTION macros.
+class TraceScope {
+    // cppcheck-suppress unknownMacro
+    NO_COPY_NO_MOVE_NO_ASSIGN(TraceScope)
+
+ public:
+    /// \brief Starts timing a scope with the given name
+    ///
+    /// \param[in] name The name of the scope (with static storage)
+    /// \param[in] category The category of the scope (with static storage)
+    explicit TraceScope(const char* name, const char* category = "loco")
+        : m_Name(name), m_Category(category) {
+        if (TraceSession::IsActive()) {
+            m_StartNs = TraceSession::Now();
+        }
+    }
+
+    /// Records the scope (if we started timing it)
+    ~TraceScope() {
+        if (m_StartNs >= 0) {
+            TraceSession::Record(m_Name, m_Category, m_StartNs,
+                                 TraceSession::Now());
+        }
+    }
+
+ private:
+    /// The name of the scope being timed
+    const char* m_Name = nullptr;
+    /// The category of the scope being timed
+    const char* m_Category = nullptr;
+    /// The time at which the scope was entered (-1 if not being recorded)
+    int64_t m_StartNs = -1;
+};
+
+}  // namespace core
+}  // namespace loco
@@ -1,12 +1,13 @@
 #pragma once
 
-// TODO(wilbert): The current implementation is intended for a moderate number
-// of drawables in the screen, as it creates a separate insteance for each that
-// does its own allocation in the heap. This can be mitigated by using custom
-// allocators, and by relaxing the constraint on both copy and move.
+// Each primitive is a separate instance, still non-copyable and non-movable.
+// When creating many of them, use MakePooled<Box>(...) instead of
+// Box::Create(...), so both the drawables and their adapters come from the
+// small-object pools (see memory_pool_t.hpp) instead of the heap.
 
 #include <string>
 
+#include <loco/core/memory_pool_t.hpp>
 #include <loco/core/visualizer/drawable_t.hpp>
 
 namespace loco {
@@ -4,11 +4,23 @@
 #include <utility>
 
 #include <loco/core/common.hpp>
+#include <loco/core/asset_cache_t.hpp>
+#include <loco/core/dirty_bitset_t.hpp>
 #include <loco/core/visualizer/impl/drawable_impl.hpp>
 
 namespace loco {
 namespace core {
 
+/// \brief Visual object that can be rendered by any visualizer backend
+///
+/// Changes to the pose, color, visibility and wireframe mode of a drawable
+/// that belongs to a scenario aren't sent to the backend right away. Instead,
+/// they're recorded as dirty flags and the drawable is marked in the dirty
+/// set of the scenario, so the visualizer sends them once per update (several
+/// changes during the same frame are coalesced into a single one). Drawables
+/// outside of a scenario send these changes to the backend immediately. The
+/// remaining changes (size, texture, mesh or heightfield data) are always
+/// sent immediately.
 class Drawable {
     // cppcheck-suppress unknownMacro
     NO_COPY_NO_MOVE_NO_ASSIGN(Drawable)
@@ -16,6 +28,15 @@ class Drawable {
     DEFINE_SMART_POINTERS(Drawable)
 
  public:
+    /// Dirty flag for changes to the pose of the drawable
+    static constexpr uint8_t DIRTY_POSE = 1U << 0U;
+    /// Dirty flag for changes to the color of the drawable
+    static constexpr uint8_t DIRTY_COLOR = 1U << 1U;
+    /// Dirty flag for changes to the visibility of the drawable
+    static constexpr uint8_t DIRTY_VISIBILITY = 1U << 2U;
+    /// Dirty flag for changes to the wireframe mode of the drawable
+    static constexpr uint8_t DIRTY_WIREFRAME = 1U << 3U;
+
     /// \brief Creates a default drawable with the given pose in world space
     ///
     /// \param[in] p_name The unique name given to this drawable
@@ -32,12 +53,17 @@ class Drawable {
 
     /// \brief Creates a drawable using the given user configuration
     ///
+    /// Meshes loaded from files are shared with identical ones used by other
+    /// objects through the AssetCache
+    ///
     /// \param[in] p_name The unique name given to this drawable
     /// \param[in] p_pose The pose of this body in world space
     /// \param[in] data Visual data used to build this drawable
     explicit Drawable(std::string p_name, Pose p_pose,
                       ::loco::DrawableData data)
-        : m_Data(std::move(data)), m_Name(std::move(p_name)), m_Pose(p_pose) {}
+        : m_Data(std::move(data)), m_Name(std::move(p_name)), m_Pose(p_pose) {
+        AssetCache::ShareIfLoaded(m_Data);
+    }
 
     /// \brief Creates a drawable with given config at given world position
     ///
@@ -49,7 +75,9 @@ class Drawable {
                       ::loco::DrawableData data)
         : m_Data(std::move(data)),
           m_Name(std::move(p_name)),
-          m_Pose(Pose(p_position, p_orientation)) {}
+          m_Pose(Pose(p_position, p_orientation)) {
+        AssetCache::ShareIfLoaded(m_Data);
+    }
 
     /// \brief Releases all allocated resources for this drawable
     ~Drawable() = default;
@@ -59,6 +87,18 @@ class Drawable {
     /// \param[in] adapter The adapter to be used by this drawable
     auto SetAdapter(IDrawableImpl::uptr adapter) -> void;
 
+    /// \brief Sets the dirty set where this drawable marks its changes
+    ///
+    /// Any pending changes are sent to the adapter before switching sets.
+    /// Called by the scenario when adding or removing this drawable.
+    ///
+    /// \param[in] dirty_set The dirty set to use (nullptr to sync eagerly)
+    /// \param[in] index The index of the bit of this drawable in the set
+    auto SetDirtyTracking(DirtyBitset::ptr dirty_set, size_t index) -> void;
+
+    /// Sends all pending changes to the adapter, and clears the dirty flags
+    auto SyncAdapter() -> void;
+
     /// \brief Sets whether or not the drawable should be visible
     ///
     /// \param[in] visible Whether or not the drawable should be visible
@@ -116,11 +156,22 @@ class Drawable {
     auto ChangeElevationData(size_t n_width_samples, size_t n_depth_samples,
                              const Scalar* ptr_heights) -> void;
 
+    /// \brief Updates a region of the elevation data of the heightfield shape
+    ///
+    /// Only the given region is written and sent to the backend, so editing
+    /// terrain (e.g. deformable or procedural) costs O(region), not O(grid)
+    ///
+    /// \param[in] region The region of the heightfield to be changed
+    /// \param[in] ptr_heights The new heights of the region (row-major, with
+    ///                        region.n_width_samples samples per row)
+    auto ChangeElevationRegion(const HeightfieldRegion& region,
+                               const Scalar* ptr_heights) -> void;
+
     /// \brief Returns the data used to build this drawable
-    auto data() const -> ::loco::DrawableData { return m_Data; }
+    auto data() const -> const ::loco::DrawableData& { return m_Data; }
 
     /// \brief Returns the name of this drawable
-    auto name() const -> std::string { return m_Name; }
+    auto name() const -> const std::string& { return m_Name; }
 
     /// \brief Returns whether or not this drawable is visible
     auto visible() const -> bool { return m_Visible; }
@@ -146,6 +197,9 @@ class Drawable {
     /// \brief Returns the size of the internal shape of the drawable
     auto size() const -> Vec3 { return m_Data.size; }
 
+    /// \brief Returns the changes not yet sent to the adapter (DIRTY_ flags)
+    auto dirty_flags() const -> uint8_t { return m_DirtyFlags; }
+
     /// \brief Returns a mutable reference to the internal drawable adapter
     auto impl() -> IDrawableImpl&;
 
@@ -155,6 +209,12 @@ class Drawable {
     /// \brief Returns the string representation of this drawable
     auto ToString() const -> std::string;
 
+ protected:
+    /// \brief Records the given changes, to be sent to the adapter later
+    ///
+    /// \param[in] flags The DIRTY_ flags of the properties that changed
+    auto _MarkDirty(uint8_t flags) -> void;
+
  protected:
     /// The configuration data for this drawable
     ::loco::DrawableData m_Data;
@@ -173,6 +233,13 @@ class Drawable {
     eVisualizerType m_VisualizerType = eVisualizerType::NONE;
     /// The adapter used to interact with the internal visualizer backend
     IDrawableImpl::uptr m_BackendImpl = nullptr;
+
+    /// The changes not yet sent to the adapter (combination of DIRTY_ flags)
+    uint8_t m_DirtyFlags = 0;
+    /// The dirty set of the scenario this drawable belongs to (if any)
+    DirtyBitset::ptr m_DirtySet = nullptr;
+    /// The index of the bit of this drawable in the dirty set
+    size_t m_DirtyIndex = 0;
 };
 
 }  // namespace core
@@ -5,6 +5,7 @@
 #include <utility>
 
 #include <loco/core/common.hpp>
+#include <loco/core/memory_pool_t.hpp>
 
 #if defined(__clang__)
 #pragma clang diagnostic push
@@ -30,6 +31,16 @@ class IDrawableImpl {
     /// \brief Releaes all allocated resources for this adapter
     virtual ~IDrawableImpl() = default;
 
+    /// Adapters are allocated from the small-object pools
+    static auto operator new(size_t size) -> void* {
+        return SmallObjectAllocator::Allocate(size);
+    }
+
+    /// Gives the memory of an adapter back to the small-object pools
+    static auto operator delete(void* ptr, size_t size) -> void {
+        SmallObjectAllocator::Deallocate(ptr, size);
+    }
+
     /// \brief Sets the pose in world-space of the associated drawable
     ///
     /// \param[in] pose The desired pose in the world frame
@@ -88,6 +99,14 @@ class IDrawableImpl {
                                      size_t n_depth_samples,
                                      const Scalar* ptr_heights) -> void = 0;
 
+    /// \brief Updates a region of the elevation data of the hfield drawable
+    ///
+    /// \param[in] region The region of the heightfield that changed
+    /// \param[in] ptr_heights The new heights of the region (row-major, with
+    ///                        region.n_width_samples samples per row)
+    virtual auto ChangeElevationRegion(const HeightfieldRegion& region,
+                                       const Scalar* ptr_heights) -> void = 0;
+
     /// \brief Updates the visibility of the associated drawable
     ///
     /// \param[in] visible Whether or not the associated drawable should be
@@ -135,6 +154,10 @@ class DrawableImplNone : public IDrawableImpl {
     auto ChangeElevationData(size_t n_width_samples, size_t n_depth_samples,
                              const Scalar* ptr_heights) -> void override {}
 
+    // Documentation inherited
+    auto ChangeElevationRegion(const HeightfieldRegion& region,
+                               const Scalar* ptr_heights) -> void override {}
+
     // Documentation inherited
     auto SetVisible(bool visible) -> void override {}
 
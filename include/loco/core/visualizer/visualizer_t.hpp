@@ -11,7 +11,10 @@
 namespace loco {
 namespace core {
 
-/// Core visualizer object, used to visualize a given scenario
+/// \brief Core visualizer object, used to visualize a given scenario
+///
+/// Thread safety: Update() reads the state of the scenario, so it shouldn't
+/// run concurrently with a simulation step on that same scenario.
 class Visualizer {
     // cppcheck-suppress unknownMacro
     NO_COPY_NO_MOVE_NO_ASSIGN(Visualizer)
@@ -6,6 +6,7 @@
 #include <loco/core/visualizer/impl/drawable_impl.hpp>
 
 #include <loco/visualizers/meshcat/common_meshcat.hpp>
+#include <loco/visualizers/meshcat/pose_batch_meshcat.hpp>
 
 namespace loco {
 namespace meshcat {
@@ -22,13 +23,19 @@ class DrawableImplMeshcat : public ::loco::core::IDrawableImpl {
     /// \param[in] name The name of the associated drawable
     /// \param[in] data The visual data associated with the drawable
     /// \param[in] handle The handle to the MeshcatCpp interface
-    explicit DrawableImplMeshcat(std::string name, ::loco::DrawableData data,
-                                 std::shared_ptr<MeshcatCpp::Meshcat> handle);
+    /// \param[in] pose_batch The batch where poses are collected each frame
+    /// (if nullptr, each pose is sent to meshcat as soon as it's set)
+    explicit DrawableImplMeshcat(
+        std::string name, ::loco::DrawableData data,
+        std::shared_ptr<MeshcatCpp::Meshcat> handle,
+        PoseBatchMeshcat::ptr pose_batch = nullptr);
 
-    ~DrawableImplMeshcat() override = default;
+    ~DrawableImplMeshcat() override;
 
     /// \brief Sets the internal pose in world space to the given value
     ///
+    /// When using a pose batch, the pose is sent on the next visualizer update
+    ///
     /// \param[in] pose The desired pose in world space
     auto SetPose(const Pose& pose) -> void override;
 
@@ -67,6 +74,13 @@ class DrawableImplMeshcat : public ::loco::core::IDrawableImpl {
     auto ChangeElevationData(size_t n_width_samples, size_t n_depth_samples,
                              const Scalar* ptr_heights) -> void override;
 
+    /// \brief Updates a region of the elevation data of the hfield drawable
+    ///
+    /// \param[in] region The region of the heightfield that changed
+    /// \param[in] ptr_heights The new heights of the region (row-major)
+    auto ChangeElevationRegion(const HeightfieldRegion& region,
+                               const Scalar* ptr_heights) -> void override;
+
     /// \brief Updates the visibility of the associated drawable
     ///
     /// \param[in] visible Whether or not the associated drawable should be
@@ -86,8 +100,17 @@ class DrawableImplMeshcat : public ::loco::core::IDrawableImpl {
     /// The associated name of the drawable we're adapting
     std::string m_Name;
 
+    /// The path of the associated object in meshcat (built once)
+    std::string m_Path;
+
     /// The handle to the MeshcatCpp interface
     std::shared_ptr<MeshcatCpp::Meshcat> m_Handle = nullptr;
+
+    /// The batch where the poses of this drawable are collected (if any)
+    PoseBatchMeshcat::ptr m_PoseBatch = nullptr;
+
+    /// The id of the entry of this drawable in the pose batch
+    size_t m_PoseEntryId = 0;
 };
 
 }  // namespace meshcat
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <loco/visualizers/meshcat/common_meshcat.hpp>
+
+namespace loco {
+namespace meshcat {
+
+/// \brief Collects the poses of the drawables of a frame, to be sent at once
+///
+/// Each drawable adapter registers its meshcat path once (so the path string
+/// is built only once) and gets an entry in the batch. Setting a pose just
+/// overwrites the transform of that entry and marks it as dirty, so a pose set
+/// several times during a frame is sent only once, and drawables that didn't
+/// move aren't sent at all. The visualizer calls Flush() once per frame.
+///
+/// Thread safety: all methods can be called from any thread.
+class PoseBatchMeshcat {
+    // cppcheck-suppress unknownMacro
+    NO_COPY_NO_MOVE_NO_ASSIGN(PoseBatchMeshcat)
+
+    DEFINE_SMART_POINTERS(PoseBatchMeshcat)
+
+ public:
+    /// Type of the transforms sent to meshcat (4x4 matrix, column-major)
+    using Transform = std::array<double, 16>;
+
+    /// Creates an empty batch
+    PoseBatchMeshcat() = default;
+
+    /// Releases all entries of this batch
+    ~PoseBatchMeshcat() = default;
+
+    /// \brief Registers a new entry for the object at the given meshcat path
+    ///
+    /// \param[in] path The full meshcat path of the object (e.g. /loco/box)
+    /// \return The id of the entry, to be used when setting poses
+    auto Register(std::string path) -> size_t;
+
+    /// \brief Releases the given entry (any pending pose is discarded)
+    ///
+    /// \param[in] entry_id The id returned when registering the entry
+    auto Unregister(size_t entry_id) -> void;
+
+    /// \brief Stores the pose of the given entry, to be sent on next Flush()
+    ///
+    /// \param[in] entry_id The id returned when registering the entry
+    /// \param[in] pose The pose of the object in world space
+    auto SetPose(size_t entry_id, const Pose& pose) -> void;
+
+    /// \brief Sends the transforms of all dirty entries to meshcat
+    ///
+    /// \param[in] handle The handle to the MeshcatCpp interface
+    /// \return The number of transforms sent
+    auto Flush(MeshcatCpp::Meshcat& handle) -> size_t;
+
+    /// Returns the number of entries with a pose pending to be sent
+    auto num_dirty() const -> size_t;
+
+ private:
+    /// The pose of a registered object, and whether it's pending to be sent
+    struct Entry {
+        /// The full meshcat path of the object (built once when registering)
+        std::string path;
+        /// The latest transform set for this object
+        Transform transform = {};
+        /// Whether or not the transform changed since the last flush
+        bool dirty = false;
+        /// Whether or not this entry is currently registered
+        bool in_use = false;
+    };
+
+    /// The entries of this batch, indexed by entry id
+    std::vector<Entry> m_Entries;
+
+    /// The ids of the entries that are free to be reused
+    std::vector<size_t> m_FreeEntries;
+
+    /// The ids of the entries marked as dirty, in the order they were set
+    /// (each id at most once, and only while its entry is registered)
+    std::vector<size_t> m_DirtyEntries;
+
+    /// Mutex used to protect the entries and the dirty list
+    mutable std::mutex m_Mutex;
+};
+
+/// \brief Converts the given pose into a column-major 4x4 transform
+///
+/// \param[in] pose The pose to be converted
+/// \return The transform as an array of doubles, as expected by meshcat
+auto ToTransform(const Pose& pose) -> PoseBatchMeshcat::Transform;
+
+}  // namespace meshcat
+}  // namespace loco
@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "./common_meshcat.hpp"
+#include "./pose_batch_meshcat.hpp"
 
 #include <loco/core/visualizer/impl/visualizer_impl.hpp>
 
@@ -27,11 +28,15 @@ class VisualizerImplMeshcat : public ::loco::core::VisualizerImpl {
 
     auto Reset() -> void override;
 
+    /// Sends to meshcat all poses that changed since the last update
     auto Update() -> void override;
 
  private:
     /// The handle to the Meshcat instance
     std::shared_ptr<MeshcatCpp::Meshcat> m_MeshcatInstance = nullptr;
+
+    /// The poses set by the drawables during the current frame
+    PoseBatchMeshcat::ptr m_PoseBatch = nullptr;
 };
 
 }  // namespace meshcat
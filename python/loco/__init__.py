@@ -8,15 +8,28 @@ from loco_bindings import (
     NUM_QPOS_JOINT_SPHERICAL,
     BackendType,
     BodyData,
+    BodyStateStore,
     ColliderData,
+    ColliderHandle,
     Drawable,
     DrawableData,
+    DrawableHandle,
     DynamicsType,
     HeightfieldData,
     InertialData,
     MeshData,
+    Scenario,
     ShapeData,
     ShapeType,
+    Simulation,
+    SimulationBatch,
+    SimulationConfig,
+    SimulationStats,
+    SingleBody,
+    SingleBodyHandle,
+    ThreadPool,
+    TraceSession,
+    Visualizer,
     VisualizerType,
 )
 
@@ -42,6 +55,24 @@ __all__ = [
     "DrawableData",
     "InertialData",
     "BodyData",
+    "SimulationConfig",
     # <drawable> Types
     "Drawable",
+    # <trace> Types
+    "TraceSession",
+    # <body> Types
+    "BodyStateStore",
+    "SingleBody",
+    # <scenario> Types
+    "Scenario",
+    "DrawableHandle",
+    "SingleBodyHandle",
+    "ColliderHandle",
+    # <simulation> Types
+    "Simulation",
+    "SimulationBatch",
+    "SimulationStats",
+    "ThreadPool",
+    # <visualizer> Types
+    "Visualizer",
 ]
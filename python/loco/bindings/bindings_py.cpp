@@ -6,12 +6,14 @@
 namespace py = pybind11;
 
 namespace loco {
-extern auto bindings_common(py::module& m) -> void;    // NOLINT
-extern auto bindings_drawable(py::module& m) -> void;  // NOLINT
+extern auto bindings_common(py::module& m) -> void;      // NOLINT
+extern auto bindings_drawable(py::module& m) -> void;    // NOLINT
+extern auto bindings_trace(py::module& m) -> void;       // NOLINT
+extern auto bindings_body(py::module& m) -> void;        // NOLINT
+extern auto bindings_scenario(py::module& m) -> void;    // NOLINT
+extern auto bindings_simulation(py::module& m) -> void;  // NOLINT
+extern auto bindings_visualizer(py::module& m) -> void;  // NOLINT
 
-//// extern auto bindings_body(py::module& m) -> void;    // NOLINT
-//// extern auto bindings_scenario(py::module& m) -> void;    // NOLINT
-//// extern auto bindings_simulation(py::module& m) -> void;  // NOLINT
 //// extern auto bindings_collider(py::module& m) -> void;  // NOLINT
 }  // namespace loco
 
@@ -28,9 +30,11 @@ PYBIND11_MODULE(loco_bindings, m) {
 
     ::loco::bindings_common(m);
     ::loco::bindings_drawable(m);
+    ::loco::bindings_trace(m);
+    ::loco::bindings_body(m);
+    ::loco::bindings_scenario(m);
+    ::loco::bindings_simulation(m);
+    ::loco::bindings_visualizer(m);
 
-    // ::loco::bindings_body(m);
-    // ::loco::bindings_scenario(m);
-    // ::loco::bindings_simulation(m);
     // ::loco::bindings_collider(m);
 }
@@ -1,4 +1,5 @@
 #include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
 
 #include <conversions_py.hpp>
 
@@ -8,8 +9,80 @@ namespace py = pybind11;
 
 namespace loco {
 
+namespace {
+/// Creates a (num_bodies, dim) array that aliases the given buffer of a store
+auto MakeStateView(py::object store_obj, Scalar* data, size_t dim)
+    -> py::array_t<Scalar> {
+    const auto NUM_BODIES = store_obj.cast<core::BodyStateStore&>().size();
+    return py::array_t<Scalar>({NUM_BODIES, dim},
+                               {dim * sizeof(Scalar), sizeof(Scalar)}, data,
+                               std::move(store_obj));
+}
+}  // namespace
+
 // NOLINTNEXTLINE
 auto bindings_body(py::module& m) -> void {
+    {
+        // The properties below expose the arrays of the store without copying
+        // them, keeping the store alive (base object) while the array is used.
+        // Writes into the arrays are seen by the bodies right away, and are
+        // sent to the backend with Scenario.PushBodyStates(). The arrays never
+        // move, but a view only covers the bodies the store had when it was
+        // taken, so get the views again after adding bodies
+        using Class = ::loco::core::BodyStateStore;
+        constexpr auto ClassName = "BodyStateStore";  // NOLINT
+        py::class_<Class, Class::ptr>(m, ClassName)
+            .def(py::init<size_t>(),
+                 py::arg("capacity") = size_t(Class::DEFAULT_CAPACITY))
+            .def_property_readonly("size", &Class::size)
+            .def_property_readonly("num_bodies", &Class::num_bodies)
+            .def_property_readonly("capacity", &Class::capacity)
+            .def("ClearForces", &Class::ClearForces)
+            .def_property_readonly(
+                "positions",
+                [](py::object self_obj) -> py::array_t<Scalar> {
+                    auto& self = self_obj.cast<Class&>();
+                    return MakeStateView(self_obj, self.positions(),
+                                         Class::DIM_POSITION);
+                })
+            .def_property_readonly(
+                "orientations",
+                [](py::object self_obj) -> py::array_t<Scalar> {
+                    auto& self = self_obj.cast<Class&>();
+                    return MakeStateView(self_obj, self.orientations(),
+                                         Class::DIM_ORIENTATION);
+                })
+            .def_property_readonly(
+                "linear_vels",
+                [](py::object self_obj) -> py::array_t<Scalar> {
+                    auto& self = self_obj.cast<Class&>();
+                    return MakeStateView(self_obj, self.linear_vels(),
+                                         Class::DIM_VEC3);
+                })
+            .def_property_readonly(
+                "angular_vels",
+                [](py::object self_obj) -> py::array_t<Scalar> {
+                    auto& self = self_obj.cast<Class&>();
+                    return MakeStateView(self_obj, self.angular_vels(),
+                                         Class::DIM_VEC3);
+                })
+            .def_property_readonly(
+                "forces",
+                [](py::object self_obj) -> py::array_t<Scalar> {
+                    auto& self = self_obj.cast<Class&>();
+                    return MakeStateView(self_obj, self.forces(),
+                                         Class::DIM_VEC3);
+                })
+            .def_property_readonly(
+                "torques",
+                [](py::object self_obj) -> py::array_t<Scalar> {
+                    auto& self = self_obj.cast<Class&>();
+                    return MakeStateView(self_obj, self.torques(),
+                                         Class::DIM_VEC3);
+                })
+            .def("__repr__",
+                 [](const Class& self) -> py::str { return self.ToString(); });
+    }
     {
         using Class = ::loco::core::SingleBody;
         constexpr auto ClassName = "SingleBody";  // NOLINT
@@ -67,11 +140,16 @@ auto bindings_body(py::module& m) -> void {
                          ::math::nparray_to_vec3<Scalar>(np_angularvel));
                  })
             .def("angular_vel", &Class::angular_vel)
+            .def("PushState", &Class::PushState)
+            .def_property_readonly("state_index", &Class::state_index)
+            .def_property_readonly("state_store", &Class::state_store)
             .def_readwrite("pose0", &Class::pose0)
             .def_readwrite("linearVel0", &Class::linearVel0)
             .def_readwrite("angularVel0", &Class::angularVel0)
-            .def_readwrite("totalForceCOM", &Class::totalForceCOM)
-            .def_readwrite("totalTorque", &Class::totalTorque)
+            .def_property("totalForceCOM", &Class::total_force_com,
+                          &Class::SetTotalForceCOM)
+            .def_property("totalTorque", &Class::total_torque,
+                          &Class::SetTotalTorque)
             .def("__repr__",
                  [](const Class& self) -> py::str { return self.ToString(); });
     }
@@ -11,6 +11,7 @@
 #include <conversions_py.hpp>
 
 #include <loco/core/common.hpp>
+#include <loco/core/mesh_loader_t.hpp>
 
 namespace py = pybind11;
 
@@ -19,6 +20,17 @@ PYBIND11_MAKE_OPAQUE(std::vector<::loco::DrawableData>);
 
 namespace loco {
 
+namespace {
+// Marks the given view of a (possibly shared) buffer as read-only. Buffers are
+// copied on write only when modified through the C++ API, so writes through a
+// view would leak into every copy sharing the buffer (and the asset cache)
+template <typename Array>
+auto AsReadOnly(Array array) -> Array {
+    array.attr("setflags")(py::arg("write") = false);
+    return array;
+}
+}  // namespace
+
 // NOLINTNEXTLINE
 auto bindings_common(py::module& m) -> void {
     m.attr("MAX_NUM_QPOS") = ::loco::MAX_NUM_QPOS;
@@ -39,6 +51,15 @@ auto bindings_common(py::module& m) -> void {
             .value("DART", Enum::DART);
     }
 
+    {
+        using Enum = ::loco::eTaskSchedulerType;
+        constexpr auto EnumName = "TaskSchedulerType";  // NOLINT
+        py::enum_<Enum>(m, EnumName)
+            .value("STD_THREAD", Enum::STD_THREAD)
+            .value("OPENMP", Enum::OPENMP)
+            .value("TBB", Enum::TBB);
+    }
+
     {
         using Enum = ::loco::eVisualizerType;
         constexpr auto EnumName = "VisualizerType";  // NOLINT
@@ -72,6 +93,17 @@ auto bindings_common(py::module& m) -> void {
             .value("STATIC", Enum::STATIC);
     }
 
+    {
+        using Enum = ::loco::eCollisionDetectorType;
+        constexpr auto EnumName = "CollisionDetectorType";  // NOLINT
+        py::enum_<Enum>(m, EnumName)
+            .value("DEFAULT", Enum::DEFAULT)
+            .value("FCL", Enum::FCL)
+            .value("ODE", Enum::ODE)
+            .value("BULLET", Enum::BULLET)
+            .value("DART", Enum::DART);
+    }
+
     {
         using Class = ::loco::MeshData;
         constexpr auto ClassName = "MeshData";  // NOLINT
@@ -96,16 +128,14 @@ auto bindings_common(py::module& m) -> void {
                     // For a non-initialized buffer just return an array of
                     // zeros with the given number of vertices
                     if (self.vertices == nullptr) {
-                        // NOLINTNEXTLINE
-                        self.vertices = std::make_unique<Scalar[]>(NUM_SCALARS);
-                        std::fill(self.vertices.get(),
-                                  self.vertices.get() + NUM_SCALARS, 0.0);
+                        self.vertices = SharedBuffer<Scalar>(NUM_SCALARS);
                     }
 
-                    // Return a view of the vertices as an np.array[float]
-                    return py::array_t<Scalar>(
+                    // Return a read-only view of the vertices (np.array[float])
+                    // (to modify them, assign a new array to this property)
+                    return AsReadOnly(py::array_t<Scalar>(
                         static_cast<ssize_t>(NUM_SCALARS), self.vertices.get(),
-                        py::cast(self));
+                        py::cast(self)));
                 },
                 [](Class& self, const py::array_t<Scalar>& array_np) -> void {
                     // We received here a numpy array from the user, which comes
@@ -125,12 +155,8 @@ auto bindings_common(py::module& m) -> void {
                     }
                     self.n_vertices = n_scalars / 3;
                     auto num_scalars = self.n_vertices * 3;
-                    if (self.vertices == nullptr) {
-                        // NOLINTNEXTLINE
-                        self.vertices = std::make_unique<Scalar[]>(num_scalars);
-                    }
-                    memcpy(self.vertices.get(), info.ptr,
-                           sizeof(Scalar) * num_scalars);
+                    self.vertices = SharedBuffer<Scalar>(
+                        static_cast<const Scalar*>(info.ptr), num_scalars);
                 })
             .def_property(
                 "faces",
@@ -147,16 +173,13 @@ auto bindings_common(py::module& m) -> void {
                     // For a non-initialized buffer just return an array of
                     // zeros with the given number of indices
                     if (self.faces == nullptr) {
-                        // NOLINTNEXTLINE
-                        self.faces = std::make_unique<uint32_t[]>(NUM_INDICES);
-                        std::fill(self.faces.get(),
-                                  self.faces.get() + NUM_INDICES, 0);
+                        self.faces = SharedBuffer<uint32_t>(NUM_INDICES);
                     }
 
-                    // Return a view of the faces as an np.array[int]
-                    return py::array_t<uint32_t>(
+                    // Return a read-only view of the faces as an np.array[int]
+                    return AsReadOnly(py::array_t<uint32_t>(
                         static_cast<ssize_t>(NUM_INDICES), self.faces.get(),
-                        py::cast(self));
+                        py::cast(self)));
                 },
                 [](Class& self, const py::array_t<uint32_t>& array_np) -> void {
                     auto info = array_np.request();
@@ -170,12 +193,8 @@ auto bindings_common(py::module& m) -> void {
                     }
                     self.n_faces = n_indices / 3;
                     n_indices = self.n_faces * 3;
-                    if (self.faces == nullptr) {
-                        // NOLINTNEXTLINE
-                        self.faces = std::make_unique<uint32_t[]>(n_indices);
-                    }
-                    memcpy(self.faces.get(), info.ptr,
-                           sizeof(uint32_t) * n_indices);
+                    self.faces = SharedBuffer<uint32_t>(
+                        static_cast<const uint32_t*>(info.ptr), n_indices);
                 })
             .def("__repr__", [](const Class& self) -> py::str {
                 return py::str(
@@ -188,6 +207,28 @@ auto bindings_common(py::module& m) -> void {
             });
     }
 
+    {
+        using Class = ::loco::core::MeshLoader;
+        constexpr auto ClassName = "MeshLoader";  // NOLINT
+        // Loading and parsing don't touch Python objects, so other threads can
+        // keep running meanwhile (e.g. when loading many meshes in parallel)
+        py::class_<Class>(m, ClassName)
+            .def_property_readonly_static(
+                "CACHE_EXTENSION",
+                [](const py::object&) { return Class::CACHE_EXTENSION; })
+            .def_static("Load", &Class::Load, py::arg("filepath"),
+                        py::call_guard<py::gil_scoped_release>())
+            .def_static("Parse", &Class::Parse, py::arg("filepath"),
+                        py::call_guard<py::gil_scoped_release>())
+            .def_static("SetCacheDirectory", &Class::SetCacheDirectory,
+                        py::arg("dirpath"))
+            .def_static("GetCacheDirectory", &Class::GetCacheDirectory)
+            .def_static("SetCacheEnabled", &Class::SetCacheEnabled,
+                        py::arg("enabled"))
+            .def_static("GetCachePath", &Class::GetCachePath,
+                        py::arg("filepath"));
+    }
+
     {
         using Class = ::loco::HeightfieldData;
         constexpr auto ClassName = "HeightfieldData";  // NOLINT
@@ -204,23 +245,21 @@ auto bindings_common(py::module& m) -> void {
                     }
                     // Initialize the buffer to zeros if not initialized yet
                     if (self.heights == nullptr) {
-                        // NOLINTNEXTLINE
-                        self.heights = std::make_unique<Scalar[]>(
+                        self.heights = SharedBuffer<Scalar>(
                             self.n_width_samples * self.n_depth_samples);
-                        std::fill(self.heights.get(),
-                                  self.heights.get() + (self.n_width_samples *
-                                                        self.n_depth_samples),
-                                  0.0);
                     }
 
-                    return py::array(
+                    // Return a read-only view of the heights (to modify them,
+                    // assign a new array to this property)
+                    return AsReadOnly(py::array(
                         py::buffer_info(
-                            self.heights.get(), sizeof(Scalar),
+                            const_cast<Scalar*>(self.heights.get()),  // NOLINT
+                            sizeof(Scalar),
                             py::format_descriptor<Scalar>::format(), 2,
                             {self.n_depth_samples, self.n_width_samples},
                             {sizeof(Scalar) * self.n_width_samples,
                              sizeof(Scalar)}),
-                        py::cast(self));
+                        py::cast(self)));
                 },
                 [](Class& self, const py::array_t<Scalar>& array_np) -> void {
                     auto info = array_np.request();
@@ -241,11 +280,10 @@ auto bindings_common(py::module& m) -> void {
                     if (old_width_samples != self.n_width_samples ||
                         old_depth_samples != self.n_depth_samples ||
                         self.heights == nullptr) {
-                        // NOLINTNEXTLINE
-                        self.heights = std::make_unique<Scalar[]>(num_samples);
+                        self.heights = SharedBuffer<Scalar>(num_samples);
                     }
 
-                    memcpy(self.heights.get(), info.ptr,
+                    memcpy(self.heights.mutable_data(), info.ptr,
                            sizeof(Scalar) * num_samples);
                 })
             .def("__repr__", [](const Class& self) -> py::str {
@@ -388,6 +426,37 @@ auto bindings_common(py::module& m) -> void {
                     .format(::loco::ToString(self.dyntype));
             });
     }
+
+    {
+        using Class = ::loco::SimulationConfig;
+        constexpr auto ClassName = "SimulationConfig";  // NOLINT
+        py::class_<Class>(m, ClassName)
+            .def(py::init<>())
+            .def_readwrite("collision_detector", &Class::collision_detector)
+            .def_readwrite("fixed_substeps", &Class::fixed_substeps)
+            .def_readwrite("multithreaded", &Class::multithreaded)
+            .def_readwrite("task_scheduler", &Class::task_scheduler)
+            .def_readwrite("num_threads", &Class::num_threads)
+            .def_readwrite("solver_iterations", &Class::solver_iterations)
+            .def_readwrite("profile_phases", &Class::profile_phases)
+            .def("__repr__", [](const Class& self) -> py::str {
+                return py::str(
+                           "<SimulationConfig\n"
+                           "  collision_detector: {}\n"
+                           "  fixed_substeps: {}\n"
+                           "  multithreaded: {}\n"
+                           "  task_scheduler: {}\n"
+                           "  num_threads: {}\n"
+                           "  solver_iterations: {}\n"
+                           "  profile_phases: {}\n"
+                           ">")
+                    .format(::loco::ToString(self.collision_detector),
+                            self.fixed_substeps, self.multithreaded,
+                            ::loco::ToString(self.task_scheduler),
+                            self.num_threads, self.solver_iterations,
+                            self.profile_phases);
+            });
+    }
 }
 
 }  // namespace loco
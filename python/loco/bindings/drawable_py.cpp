@@ -1,6 +1,8 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
 
+#include <stdexcept>
+
 #include <conversions_py.hpp>
 
 #include <utils/logging.hpp>
@@ -45,6 +47,30 @@ auto bindings_drawable(py::module& m) -> void {
                     LOG_CORE_INFO("np_heights.size = {}", info_heights.size);
                     LOG_CORE_INFO("np_heights.ndim = {}", info_heights.ndim);
                 })
+            .def(
+                "ChangeElevationRegion",
+                [](Class& self, size_t width_start, size_t depth_start,
+                   const py::array_t<Scalar, py::array::c_style |
+                                                 py::array::forcecast>&
+                       np_heights) -> void {
+                    auto info_heights = np_heights.request();
+                    if (info_heights.ndim != 2) {
+                        throw std::runtime_error(
+                            "Drawable::ChangeElevationRegion >>> Expected a "
+                            "2D array of heights (depth x width)");
+                    }
+                    ::loco::HeightfieldRegion region;
+                    region.width_start = width_start;
+                    region.depth_start = depth_start;
+                    region.n_depth_samples =
+                        static_cast<size_t>(info_heights.shape[0]);
+                    region.n_width_samples =
+                        static_cast<size_t>(info_heights.shape[1]);
+                    self.ChangeElevationRegion(
+                        region, static_cast<const Scalar*>(info_heights.ptr));
+                },
+                py::arg("width_start"), py::arg("depth_start"),
+                py::arg("heights"))
             .def("__repr__",
                  [](const Class& self) -> py::str { return self.ToString(); });
     }
@@ -8,18 +8,70 @@ namespace py = pybind11;
 
 namespace loco {
 
+template <typename T>
+auto bindings_handle(py::module& m, const char* class_name) -> void {
+    using Class = ::loco::core::Handle<T>;
+    py::class_<Class>(m, class_name)
+        .def(py::init<>())
+        .def_readonly("index", &Class::index)
+        .def_readonly("generation", &Class::generation)
+        .def("valid", &Class::valid)
+        .def("__eq__", &Class::operator==)
+        .def("__ne__", &Class::operator!=)
+        .def("__hash__",
+             [](const Class& self) -> size_t {
+                 return (static_cast<size_t>(self.generation) << 32U) |
+                        static_cast<size_t>(self.index);
+             })
+        .def("__repr__",
+             [](const Class& self) -> py::str { return self.ToString(); });
+}
+
 // NOLINTNEXTLINE
 auto bindings_scenario(py::module& m) -> void {
+    bindings_handle<::loco::core::Drawable>(m, "DrawableHandle");
+    bindings_handle<::loco::core::SingleBody>(m, "SingleBodyHandle");
+    bindings_handle<::loco::core::SingleBodyCollider>(m, "ColliderHandle");
+
     {
         using Class = ::loco::core::Scenario;
         constexpr auto ClassName = "Scenario";  // NOLINT
+        // Objects are returned as shared pointers (never as raw pointers owned
+        // by the scenario), so Python can keep them alive on its own
         py::class_<Class, Class::ptr>(m, ClassName)
-            .def(py::init<>())
-            .def_property_readonly("num_bodies", &Class::num_bodies)
-            .def("__repr__", [](const Class& self) -> py::str {
-                return py::str("Scenario(num_bodies={}, max_bodies={})")
-                    .format(self.num_bodies(), Class::MAX_BODIES);
-            });
+            .def(py::init<size_t>(), py::arg("max_single_bodies") =
+                                         size_t(Class::RESERVED_SINGLE_BODIES))
+            .def("AddDrawable", &Class::AddDrawable)
+            .def("RemoveDrawable", &Class::RemoveDrawable)
+            .def("FindDrawable", &Class::FindDrawable)
+            .def("GetDrawable",
+                 [](Class& self, ::loco::core::DrawableHandle handle) {
+                     return (self.GetDrawable(handle) != nullptr)
+                                ? self.GetDrawableByIndex(handle.index)
+                                : nullptr;
+                 })
+            .def("GetDrawableByIndex", &Class::GetDrawableByIndex)
+            .def("GetDrawableByName", &Class::GetDrawableByName)
+            .def_property_readonly("num_drawables", &Class::num_drawables)
+            .def_property_readonly("num_drawable_slots",
+                                   &Class::num_drawable_slots)
+            .def("SyncDrawables", &Class::SyncDrawables)
+            .def_property_readonly("num_dirty_drawables",
+                                   &Class::num_dirty_drawables)
+            .def("AddSingleBody", &Class::AddSingleBody)
+            .def("GetSingleBody",
+                 [](Class& self, ::loco::core::SingleBodyHandle handle) {
+                     return (self.GetSingleBody(handle) != nullptr)
+                                ? self.GetSingleBodyByIndex(handle.index)
+                                : nullptr;
+                 })
+            .def("GetSingleBodyByIndex", &Class::GetSingleBodyByIndex)
+            .def("PushBodyStates", &Class::PushBodyStates)
+            .def_property_readonly("num_single_bodies",
+                                   &Class::num_single_bodies)
+            .def_property_readonly("body_states", &Class::body_states)
+            .def("__repr__",
+                 [](const Class& self) -> py::str { return self.ToString(); });
     }
 }
 
@@ -1,8 +1,13 @@
 #include <pybind11/pybind11.h>
+#include <pybind11/functional.h>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
 
 #include <conversions_py.hpp>
 
 #include <loco/core/simulation_t.hpp>
+#include <loco/core/simulation_batch_t.hpp>
+#include <loco/core/thread_pool_t.hpp>
 
 namespace py = pybind11;
 
@@ -11,13 +16,45 @@ namespace loco {
 // NOLINTNEXTLINE
 auto bindings_simulation(py::module& m) -> void {
     {
+        // Long-running calls (Init, Reset, Step, Wait) release the GIL, so
+        // other Python threads can run while the physics backend is working
         using Class = ::loco::core::Simulation;
         constexpr auto ClassName = "Simulation";  // NOLINT
         py::class_<Class, Class::ptr>(m, ClassName)
-            .def(py::init<::loco::core::Scenario::ptr, ::loco::eBackendType>())
-            .def("Init", &Class::Init)
-            .def("Reset", &Class::Reset)
-            .def("Step", &Class::Step)
+            .def(py::init<::loco::core::Scenario::ptr, ::loco::eBackendType,
+                          ::loco::SimulationConfig>(),
+                 py::arg("scenario"), py::arg("backend_type"),
+                 py::arg("config") = ::loco::SimulationConfig())
+            .def("Init", &Class::Init, py::call_guard<py::gil_scoped_release>())
+            .def("Reset", &Class::Reset,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("Step", &Class::Step, py::call_guard<py::gil_scoped_release>())
+            .def(
+                "StepAsync",
+                [](Class& self, Scalar step) { self.StepAsync(step); },
+                py::call_guard<py::gil_scoped_release>())
+            .def("Wait", &Class::Wait, py::call_guard<py::gil_scoped_release>())
+            .def("Poll", &Class::Poll)
+            .def("SetThreadPool", &Class::SetThreadPool)
+            .def("SaveState",
+                 [](Class& self) -> py::array_t<uint8_t> {
+                     py::array_t<uint8_t> np_state(self.state_size());
+                     self.SaveState(np_state.mutable_data(),
+                                    static_cast<size_t>(np_state.size()));
+                     return np_state;
+                 })
+            .def("SaveState",
+                 [](Class& self, py::array_t<uint8_t>& np_state) {
+                     self.SaveState(np_state.mutable_data(),
+                                    static_cast<size_t>(np_state.size()));
+                 },
+                 py::arg("buffer").noconvert())
+            .def("LoadState",
+                 [](Class& self, const py::array_t<uint8_t>& np_state) {
+                     self.LoadState(np_state.data(),
+                                    static_cast<size_t>(np_state.size()));
+                 })
+            .def_property_readonly("state_size", &Class::state_size)
             .def("SetTimeStep", &Class::SetTimeStep)
             .def("SetGravity",
                  [](Class& self, const py::array_t<Scalar>& np_gravity) {
@@ -27,6 +64,11 @@ auto bindings_simulation(py::module& m) -> void {
             .def_property_readonly("timestep", &Class::timestep)
             .def_property_readonly("gravity", &Class::gravity)
             .def_property_readonly("backend_type", &Class::backend_type)
+            .def_property_readonly("config", &Class::config)
+            // The stats live in the backend and are updated in place, so the
+            // returned object always reflects the last step (no copies)
+            .def_property_readonly("stats", &Class::stats,
+                                   py::return_value_policy::reference_internal)
             .def("__repr__", [](const Class& self) -> py::str {
                 return py::str(
                            "<Simulation\n"
@@ -38,6 +80,133 @@ auto bindings_simulation(py::module& m) -> void {
                             ::loco::ToString(self.backend_type()));
             });
     }
+
+    {
+        using Class = ::loco::core::SimulationStats;
+        constexpr auto ClassName = "SimulationStats";  // NOLINT
+        py::class_<Class>(m, ClassName)
+            .def_readonly("num_steps", &Class::num_steps)
+            .def_readonly("num_substeps", &Class::num_substeps)
+            .def_readonly("num_contacts", &Class::num_contacts)
+            .def_readonly("num_constraint_rows", &Class::num_constraint_rows)
+            .def_readonly("num_broadphase_pairs", &Class::num_broadphase_pairs)
+            .def_readonly("step_time", &Class::step_time)
+            .def_readonly("collision_time", &Class::collision_time)
+            .def_readonly("solver_time", &Class::solver_time)
+            .def("__repr__", [](const Class& self) -> py::str {
+                return py::str(
+                           "<SimulationStats\n"
+                           "  num_steps={}\n"
+                           "  num_substeps={}\n"
+                           "  num_contacts={}\n"
+                           "  step_time={}\n"
+                           ">")
+                    .format(self.num_steps, self.num_substeps,
+                            self.num_contacts, self.step_time);
+            });
+    }
+
+    {
+        using Class = ::loco::core::ThreadPool;
+        constexpr auto ClassName = "ThreadPool";  // NOLINT
+        py::class_<Class, Class::ptr>(m, ClassName)
+            .def(py::init<size_t, bool>(), py::arg("num_workers") = 0,
+                 py::arg("pin_to_cores") = false)
+            .def("WaitIdle", &Class::WaitIdle,
+                 py::call_guard<py::gil_scoped_release>())
+            .def_property_readonly("num_workers", &Class::num_workers)
+            .def_property_readonly("pinned", &Class::pinned)
+            .def("__repr__",
+                 [](const Class& self) -> py::str { return self.ToString(); });
+    }
+
+    {
+        // Stepping and resetting release the GIL. The scenario factory and the
+        // observation callback may be Python functions, which reacquire the
+        // GIL by themselves when they're called from C++
+        using Class = ::loco::core::SimulationBatch;
+        constexpr auto ClassName = "SimulationBatch";  // NOLINT
+        py::class_<Class, Class::ptr>(m, ClassName)
+            .def(py::init<size_t, const Class::ScenarioFactory&,
+                          ::loco::eBackendType>())
+            .def("Init", &Class::Init,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("StepAll", &Class::StepAll,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("ResetAll", &Class::ResetAll,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("ResetSome", &Class::ResetSome,
+                 py::call_guard<py::gil_scoped_release>())
+            // Python callbacks get fn(env_index, simulation, observation),
+            // where observation is a writable (obs_dim,) view into the row of
+            // the env. in the observations buffer (no copies)
+            .def(
+                "SetObservationFn",
+                [](Class& self, size_t obs_dim, py::function obs_fn) {
+                    // The batch keeps the callback alive, and it might be
+                    // released from a thread without the GIL, so take it then
+                    std::shared_ptr<py::function> fn_handle(
+                        new py::function(std::move(obs_fn)),
+                        [](py::function* fn) {
+                            py::gil_scoped_acquire gil;
+                            delete fn;  // NOLINT
+                        });
+                    auto* batch = &self;
+                    self.SetObservationFn(
+                        obs_dim,
+                        [batch, fn_handle, obs_dim](
+                            size_t env_index,
+                            const ::loco::core::Simulation& simulation,
+                            Scalar* observation) {
+                            py::gil_scoped_acquire gil;
+                            // The view keeps the batch (the owner of the
+                            // buffer) alive, in case Python holds onto it
+                            auto batch_obj = py::cast(
+                                batch, py::return_value_policy::reference);
+                            py::array_t<Scalar> np_observation(
+                                {obs_dim}, {sizeof(Scalar)}, observation,
+                                batch_obj);
+                            (*fn_handle)(
+                                env_index,
+                                py::cast(&simulation,
+                                         py::return_value_policy::reference),
+                                np_observation);
+                        });
+                },
+                py::arg("obs_dim"), py::arg("obs_fn"))
+            .def("CollectObservations", &Class::CollectObservations)
+            .def("SetTimeStep", &Class::SetTimeStep)
+            .def("SetGravity",
+                 [](Class& self, const py::array_t<Scalar>& np_gravity) {
+                     self.SetGravity(
+                         ::math::nparray_to_vec3<Scalar>(np_gravity));
+                 })
+            .def("SetThreadPool", &Class::SetThreadPool)
+            .def_property_readonly("thread_pool", &Class::thread_pool)
+            .def(
+                "simulation",
+                [](Class& self, size_t index) -> ::loco::core::Simulation& {
+                    return self.simulation(index);
+                },
+                py::return_value_policy::reference_internal)
+            .def("scenario", &Class::scenario)
+            .def_property_readonly("num_envs", &Class::num_envs)
+            .def_property_readonly("obs_dim", &Class::obs_dim)
+            .def_property_readonly("backend_type", &Class::backend_type)
+            // Exposes the observations buffer without copying it. The array
+            // keeps the batch alive (base object), so it's safe to hold it
+            .def_property_readonly(
+                "observations",
+                [](py::object self_obj) -> py::array_t<Scalar> {
+                    auto& self = self_obj.cast<Class&>();
+                    return py::array_t<Scalar>(
+                        {self.num_envs(), self.obs_dim()},
+                        {self.obs_dim() * sizeof(Scalar), sizeof(Scalar)},
+                        self.observations(), self_obj);
+                })
+            .def("__repr__",
+                 [](const Class& self) -> py::str { return self.ToString(); });
+    }
 }
 
 }  // namespace loco
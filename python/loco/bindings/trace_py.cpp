@@ -0,0 +1,29 @@
+#include <pybind11/pybind11.h>
+
+#include <loco/core/trace_session_t.hpp>
+
+namespace py = pybind11;
+
+namespace loco {
+
+// NOLINTNEXTLINE
+auto bindings_trace(py::module& m) -> void {
+    {
+        using Class = ::loco::core::TraceSession;
+        constexpr auto ClassName = "TraceSession";  // NOLINT
+        // Only the session controls are exposed, as the scopes are recorded
+        // by the instrumented C++ code (their names must be static strings)
+        py::class_<Class>(m, ClassName)
+            .def_property_readonly_static(
+                "BUFFER_CAPACITY",
+                [](const py::object&) { return Class::BUFFER_CAPACITY; })
+            .def_static("Begin", &Class::Begin)
+            .def_static("End", &Class::End)
+            .def_static("IsActive", &Class::IsActive)
+            .def_static("ToChromeTrace", &Class::ToChromeTrace)
+            .def_static("WriteChromeTrace", &Class::WriteChromeTrace,
+                        py::arg("filepath"));
+    }
+}
+
+}  // namespace loco
@@ -0,0 +1,35 @@
+#include <pybind11/pybind11.h>
+
+#include <conversions_py.hpp>
+
+#include <loco/core/visualizer/visualizer_t.hpp>
+
+namespace py = pybind11;
+
+namespace loco {
+
+// NOLINTNEXTLINE
+auto bindings_visualizer(py::module& m) -> void {
+    {
+        // Init, Reset and Update can take a while (e.g. sending geometry to
+        // the meshcat server), so they release the GIL while they run
+        using Class = ::loco::core::Visualizer;
+        constexpr auto ClassName = "Visualizer";  // NOLINT
+        py::class_<Class, Class::ptr>(m, ClassName)
+            .def(py::init<::loco::core::Scenario::ptr>())
+            .def("Init", &Class::Init,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("Reset", &Class::Reset,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("Update", &Class::Update,
+                 py::call_guard<py::gil_scoped_release>())
+            .def("AddDrawable", &Class::AddDrawable)
+            .def_property_readonly("visualizer_type", &Class::visualizer_type)
+            .def("__repr__", [](const Class& self) -> py::str {
+                return py::str("<Visualizer\n  visualizer_type={}\n>")
+                    .format(::loco::ToString(self.visualizer_type()));
+            });
+    }
+}
+
+}  // namespace loco
@@ -82,6 +82,7 @@ class CMakeBuild(build_ext):
             "-DLOCO_BUILD_PYTHON_BINDINGS:BOOL=ON",
             "-DLOCO_BUILD_EXAMPLES:BOOL=OFF",
             "-DLOCO_BUILD_TESTS:BOOL=OFF",
+            "-DLOCO_BUILD_BENCHMARKS:BOOL=OFF",
             "-DLOCO_BUILD_DOCS:BOOL=OFF",
             "-DLOCO_BUILD_BACKEND_MUJOCO:BOOL=OFF",
             "-DLOCO_BUILD_BACKEND_BULLET:BOOL=OFF",
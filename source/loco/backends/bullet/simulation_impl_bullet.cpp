@@ -10,32 +10,251 @@
 
 #include <loco/backends/bullet/simulation_impl_bullet.hpp>
 
+#if defined(LOCO_BULLET_MULTITHREADING_ENABLED)
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
+#include <LinearMath/btThreads.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace loco {
 namespace bullet {
 
-SimulationImplBullet::SimulationImplBullet(core::Scenario::ptr scenario)
-    : SimulationImpl(std::move(scenario)) {
+namespace {
+/// Number of scalars stored per collision object: pos(3) | quat(4) |
+/// linear-vel(3) | angular-vel(3) | activation-state(1) | deactivation-time(1)
+constexpr size_t NUM_SCALARS_PER_OBJECT = 15;
+
+/// Tolerance used to avoid an extra substep due to floating-point error when
+/// the step is an exact multiple of the fixed timestep (e.g. 0.01 / 0.001)
+constexpr double SUBSTEPS_TOLERANCE = 1e-9;
+
+/// Returns the seconds of wall-clock time elapsed since the given time point
+auto SecondsSince(std::chrono::steady_clock::time_point start) -> double {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         start)
+        .count();
+}
+}  // namespace
+
+class IFixedStepWorld {
+ public:
+    virtual ~IFixedStepWorld() = default;
+
+    /// Takes the given number of internal steps of the given size
+    virtual auto StepFixed(int num_substeps, btScalar timestep) -> void = 0;
+};
+
+namespace {
+/// \brief Dynamics world of the given type used by this backend
+///
+/// Adds the time spent in collision detection and in the constraint solver of
+/// each substep to the given stats (if any), and steps a fixed number of
+/// substeps following what stepSimulation does, minus the leftover time and
+/// the interpolation of motion states
+template <typename World>
+class LocoWorld : public World, public IFixedStepWorld {
+ public:
+    template <typename... Args>
+    explicit LocoWorld(core::SimulationStats* stats, Args&&... args)
+        : World(std::forward<Args>(args)...), m_Stats(stats) {}
+
+    auto StepFixed(int num_substeps, btScalar timestep) -> void override {
+        // With no leftover time and no latency interpolation, motion states
+        // get the transforms of the bodies as they are
+        const bool LATENCY = this->getLatencyMotionStateInterpolation();
+        this->setLatencyMotionStateInterpolation(false);
+        this->m_localTime = 0;
+        this->m_fixedTimeStep = timestep;
+        if (num_substeps > 0) {
+            this->saveKinematicState(timestep *
+                                     static_cast<btScalar>(num_substeps));
+            this->applyGravity();
+            for (int i = 0; i < num_substeps; ++i) {
+                this->internalSingleStepSimulation(timestep);
+                this->synchronizeMotionStates();
+            }
+        } else {
+            this->synchronizeMotionStates();
+        }
+        this->clearForces();
+        this->setLatencyMotionStateInterpolation(LATENCY);
+    }
+
+    auto performDiscreteCollisionDetection() -> void override {
+        if (m_Stats == nullptr) {
+            World::performDiscreteCollisionDetection();
+            return;
+        }
+        const auto START = std::chrono::steady_clock::now();
+        World::performDiscreteCollisionDetection();
+        m_Stats->collision_time += SecondsSince(START);
+    }
+
+ protected:
+    auto solveConstraints(btContactSolverInfo& solver_info) -> void override {
+        if (m_Stats == nullptr) {
+            World::solveConstraints(solver_info);
+            return;
+        }
+        const auto START = std::chrono::steady_clock::now();
+        World::solveConstraints(solver_info);
+        m_Stats->solver_time += SecondsSince(START);
+    }
+
+ private:
+    /// Stats of the backend that owns this world (nullptr to not profile)
+    core::SimulationStats* m_Stats = nullptr;
+};
+
+/// Creates a world of the given type for this backend
+template <typename World, typename... Args>
+auto CreateWorld(core::SimulationStats* stats, IFixedStepWorld*& fixed_world,
+                 Args&&... args) -> std::unique_ptr<btDynamicsWorld> {
+    auto world =
+        std::make_unique<LocoWorld<World>>(stats, std::forward<Args>(args)...);
+    fixed_world = world.get();
+    return world;
+}
+
+#if defined(LOCO_BULLET_MULTITHREADING_ENABLED)
+/// Max. number of collision algorithms the Mt dispatcher allocates per batch
+constexpr int DISPATCHER_GRAIN_SIZE = 40;
+
+/// Sets the task scheduler of the given type as Bullet's global scheduler
+auto SetupTaskScheduler(eTaskSchedulerType scheduler_type, size_t num_threads)
+    -> bool {
+    // Schedulers are created once and shared by all worlds in the process
+    static std::mutex s_Mutex;
+    static std::array<std::unique_ptr<btITaskScheduler>, 3> s_Schedulers;
+
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    auto& scheduler = s_Schedulers[static_cast<size_t>(scheduler_type)];
+    if (scheduler == nullptr) {
+        switch (scheduler_type) {
+            case eTaskSchedulerType::STD_THREAD:
+                scheduler.reset(btCreateDefaultTaskScheduler());
+                break;
+            case eTaskSchedulerType::OPENMP:
+                scheduler.reset(btCreateOpenMPTaskScheduler());
+                break;
+            case eTaskSchedulerType::TBB:
+                scheduler.reset(btCreateTBBTaskScheduler());
+                break;
+        }
+    }
+    // Bullet returns nullptr for schedulers it wasn't compiled with
+    if (scheduler == nullptr) {
+        return false;
+    }
+
+    const auto MAX_THREADS = scheduler->getMaxNumThreads();
+    const auto NUM_THREADS = static_cast<int>(num_threads);
+    scheduler->setNumThreads((NUM_THREADS == 0)
+                                 ? MAX_THREADS
+                                 : std::min(NUM_THREADS, MAX_THREADS));
+    btSetTaskScheduler(scheduler.get());
+    return true;
+}
+#endif
+}  // namespace
+
+SimulationImplBullet::SimulationImplBullet(core::Scenario::ptr scenario,
+                                           const SimulationConfig& config)
+    : SimulationImpl(std::move(scenario), config),
+      m_FixedSubsteps(config.fixed_substeps) {
     // Implement any required initial setup for the bullet backend
 }
 
+SimulationImplBullet::~SimulationImplBullet() {
+    // The world uses the other resources while it's being destroyed
+    m_FixedStepWorld = nullptr;
+    m_World = nullptr;
+}
+
 auto SimulationImplBullet::Init() -> void {
+    m_FixedStepWorld = nullptr;
+    m_World = nullptr;
+    m_LastNumSubsteps = 0;
+    m_NumSubstepsTaken = 0;
+
+    bool use_multithreading = m_Config.multithreaded;
+#if defined(LOCO_BULLET_MULTITHREADING_ENABLED)
+    if (use_multithreading &&
+        !SetupTaskScheduler(m_Config.task_scheduler, m_Config.num_threads)) {
+        LOCO_CORE_WARN(
+            "SimulationImplBullet::Init >>> Task scheduler '{}' isn't "
+            "available, falling back to '{}'",
+            ToString(m_Config.task_scheduler),
+            ToString(eTaskSchedulerType::STD_THREAD));
+        use_multithreading = SetupTaskScheduler(eTaskSchedulerType::STD_THREAD,
+                                                m_Config.num_threads);
+    }
+#else
+    if (use_multithreading) {
+        LOCO_CORE_WARN(
+            "SimulationImplBullet::Init >>> loco was built without support for "
+            "multithreaded Bullet worlds (LOCO_BUILD_BULLET_MULTITHREADING), "
+            "using a single-threaded world instead");
+        use_multithreading = false;
+    }
+#endif
+
+    // Phase times are only measured if requested
+    auto* stats = m_Config.profile_phases ? &m_Stats : nullptr;
     // clang-format off
     m_CollisionConfig =
         std::make_unique<btDefaultCollisionConfiguration>();
-    m_CollisionDispatcher =
-        std::make_unique<btCollisionDispatcher>(m_CollisionConfig.get());
     m_Broadphase =
         std::make_unique<btDbvtBroadphase>();
-    m_ConstraintSolver =
-        std::make_unique<btSequentialImpulseConstraintSolver>();
-    m_World =
-        std::make_unique<btDiscreteDynamicsWorld>(m_CollisionDispatcher.get(),
-                                                  m_Broadphase.get(),
-                                                  m_ConstraintSolver.get(),
-                                                  m_CollisionConfig.get());
+#if defined(LOCO_BULLET_MULTITHREADING_ENABLED)
+    if (use_multithreading) {
+        m_CollisionDispatcher =
+            std::make_unique<btCollisionDispatcherMt>(m_CollisionConfig.get(),
+                                                      DISPATCHER_GRAIN_SIZE);
+        m_ConstraintSolver =
+            std::make_unique<btConstraintSolverPoolMt>(BT_MAX_THREAD_COUNT);
+        m_ConstraintSolverMt =
+            std::make_unique<btSequentialImpulseConstraintSolverMt>();
+        m_World = CreateWorld<btDiscreteDynamicsWorldMt>(
+            stats, m_FixedStepWorld,
+            m_CollisionDispatcher.get(),
+            m_Broadphase.get(),
+            static_cast<btConstraintSolverPoolMt*>(m_ConstraintSolver.get()),
+            m_ConstraintSolverMt.get(),
+            m_CollisionConfig.get());
+    }
+#endif
+    if (m_World == nullptr) {
+        m_CollisionDispatcher =
+            std::make_unique<btCollisionDispatcher>(m_CollisionConfig.get());
+        m_ConstraintSolver =
+            std::make_unique<btSequentialImpulseConstraintSolver>();
+        m_ConstraintSolverMt = nullptr;
+        m_World = CreateWorld<btDiscreteDynamicsWorld>(
+            stats, m_FixedStepWorld,
+            m_CollisionDispatcher.get(),
+            m_Broadphase.get(),
+            m_ConstraintSolver.get(),
+            m_CollisionConfig.get());
+    }
     // clang-format on
+
+    if (m_Config.solver_iterations > 0) {
+        m_World->getSolverInfo().m_numIterations =
+            static_cast<int>(m_Config.solver_iterations);
+    }
 }
 
 auto SimulationImplBullet::Reset() -> void {
@@ -43,10 +262,58 @@ auto SimulationImplBullet::Reset() -> void {
 }
 
 auto SimulationImplBullet::Step(Scalar step) -> void {
-    if (m_World != nullptr) {
-        m_World->stepSimulation(step, static_cast<int>(m_MaxSubSteps),
-                                m_FixedTimeStep);
+    LOCO_PROFILE_SCOPE("SimulationImplBullet::Step");
+    if (m_World == nullptr) {
+        return;
+    }
+
+    // Filled by the world while stepping (only if profiling the phases)
+    m_Stats.collision_time = 0.0;
+    m_Stats.solver_time = 0.0;
+    if (!m_FixedSubsteps) {
+        // Bullet returns the number of substeps before clamping them to the
+        // max. number of substeps, which is the number it actually takes
+        const auto NUM_SUBSTEPS = static_cast<size_t>(m_World->stepSimulation(
+            step, static_cast<int>(m_MaxSubSteps), m_FixedTimeStep));
+        m_LastNumSubsteps = std::min(NUM_SUBSTEPS, m_MaxSubSteps);
+    } else {
+        m_LastNumSubsteps = num_substeps(step);
+        m_FixedStepWorld->StepFixed(static_cast<int>(m_LastNumSubsteps),
+                                    m_FixedTimeStep);
     }
+    m_NumSubstepsTaken += m_LastNumSubsteps;
+    _UpdateStats();
+}
+
+auto SimulationImplBullet::_UpdateStats() -> void {
+    m_Stats.num_substeps = m_LastNumSubsteps;
+
+    size_t num_contacts = 0;
+    const auto NUM_MANIFOLDS = m_CollisionDispatcher->getNumManifolds();
+    for (int i = 0; i < NUM_MANIFOLDS; ++i) {
+        const auto* manifold =
+            m_CollisionDispatcher->getManifoldByIndexInternal(i);
+        num_contacts += static_cast<size_t>(manifold->getNumContacts());
+    }
+    m_Stats.num_contacts = num_contacts;
+    m_Stats.num_broadphase_pairs = static_cast<size_t>(
+        m_Broadphase->getOverlappingPairCache()->getNumOverlappingPairs());
+}
+
+auto SimulationImplBullet::SetFixedSubsteps(bool enabled) -> void {
+    m_FixedSubsteps = enabled;
+}
+
+auto SimulationImplBullet::num_substeps(Scalar step) const -> size_t {
+    if (m_FixedTimeStep <= 0.0) {
+        return 0;
+    }
+    // Always take at least one substep, even if step < timestep
+    const auto NUM_SUBSTEPS = static_cast<int64_t>(
+        std::ceil(static_cast<double>(step) /
+                      static_cast<double>(m_FixedTimeStep) -
+                  SUBSTEPS_TOLERANCE));
+    return static_cast<size_t>(std::max<int64_t>(1, NUM_SUBSTEPS));
 }
 
 auto SimulationImplBullet::SetTimeStep(Scalar step) -> void {
@@ -64,6 +331,134 @@ auto SimulationImplBullet::SetGravity(const Vec3& gravity) -> void {
     }
 }
 
+auto SimulationImplBullet::state_size() const -> size_t {
+    if (m_World == nullptr) {
+        return 0;
+    }
+    const auto NUM_OBJECTS =
+        static_cast<size_t>(m_World->getNumCollisionObjects());
+    return sizeof(btScalar) * NUM_SCALARS_PER_OBJECT * NUM_OBJECTS;
+}
+
+auto SimulationImplBullet::SaveState(uint8_t* buffer) const -> void {
+    if (m_World == nullptr) {
+        return;
+    }
+
+    // NOTE(wilbert): Bullet keeps a contact cache (persistent manifolds) that
+    // is used to warmstart the solver, and it's not part of the snapshot (it's
+    // rebuilt from scratch when loading one instead, see LoadState)
+    std::array<btScalar, NUM_SCALARS_PER_OBJECT> state{};
+    const auto& objects = m_World->getCollisionObjectArray();
+    for (int i = 0; i < objects.size(); ++i) {
+        const auto* object = objects[i];
+        const auto& tf = object->getWorldTransform();
+        const auto& pos = tf.getOrigin();
+        const auto quat = tf.getRotation();
+        state.fill(0.0);
+        state[0] = pos.x();
+        state[1] = pos.y();
+        state[2] = pos.z();
+        state[3] = quat.x();
+        state[4] = quat.y();
+        state[5] = quat.z();
+        state[6] = quat.w();
+        const auto* body = btRigidBody::upcast(object);
+        if (body != nullptr) {
+            const auto& linear_vel = body->getLinearVelocity();
+            const auto& angular_vel = body->getAngularVelocity();
+            state[7] = linear_vel.x();
+            state[8] = linear_vel.y();
+            state[9] = linear_vel.z();
+            state[10] = angular_vel.x();
+            state[11] = angular_vel.y();
+            state[12] = angular_vel.z();
+        }
+        // Sleeping objects aren't simulated, so restoring only the kinematic
+        // state isn't enough to replay the steps that follow deterministically
+        state[13] = static_cast<btScalar>(object->getActivationState());
+        state[14] = object->getDeactivationTime();
+        memcpy(buffer, state.data(), sizeof(state));
+        buffer += sizeof(state);  // NOLINT
+    }
+}
+
+auto SimulationImplBullet::LoadState(const uint8_t* buffer) -> void {
+    if (m_World == nullptr) {
+        return;
+    }
+
+    std::array<btScalar, NUM_SCALARS_PER_OBJECT> state{};
+    auto& objects = m_World->getCollisionObjectArray();
+    for (int i = 0; i < objects.size(); ++i) {
+        memcpy(state.data(), buffer, sizeof(state));
+        buffer += sizeof(state);  // NOLINT
+
+        auto* object = objects[i];
+        const btTransform tf(
+            btQuaternion(state[3], state[4], state[5], state[6]),
+            btVector3(state[0], state[1], state[2]));
+        object->setWorldTransform(tf);
+        object->setInterpolationWorldTransform(tf);
+        // Force the saved state, as setActivationState doesn't override the
+        // DISABLE_DEACTIVATION and DISABLE_SIMULATION states
+        object->forceActivationState(static_cast<int>(state[13]));
+        object->setDeactivationTime(state[14]);
+
+        auto* body = btRigidBody::upcast(object);
+        if (body != nullptr) {
+            const btVector3 linear_vel(state[7], state[8], state[9]);
+            const btVector3 angular_vel(state[10], state[11], state[12]);
+            body->setLinearVelocity(linear_vel);
+            body->setAngularVelocity(angular_vel);
+            body->setInterpolationLinearVelocity(linear_vel);
+            body->setInterpolationAngularVelocity(angular_vel);
+            if (body->getMotionState() != nullptr) {
+                body->getMotionState()->setWorldTransform(tf);
+            }
+        }
+    }
+
+    _ResetContactCache();
+}
+
+auto SimulationImplBullet::_ResetContactCache() -> void {
+    // Re-adding all objects (in their original order) destroys their pairs and
+    // persistent manifolds, and recomputes the overlapping pairs from the
+    // restored transforms, as if the objects were just added to the world
+    struct ObjectEntry {
+        btCollisionObject* object;
+        int group;
+        int mask;
+    };
+    std::vector<ObjectEntry> entries;
+    const auto& objects = m_World->getCollisionObjectArray();
+    entries.reserve(static_cast<size_t>(objects.size()));
+    for (int i = 0; i < objects.size(); ++i) {
+        const auto* proxy = objects[i]->getBroadphaseHandle();
+        entries.push_back({objects[i], proxy->m_collisionFilterGroup,
+                           proxy->m_collisionFilterMask});
+    }
+    for (const auto& entry : entries) {
+        auto* body = btRigidBody::upcast(entry.object);
+        if (body != nullptr) {
+            m_World->removeRigidBody(body);
+        } else {
+            m_World->removeCollisionObject(entry.object);
+        }
+    }
+    for (const auto& entry : entries) {
+        auto* body = btRigidBody::upcast(entry.object);
+        if (body != nullptr) {
+            m_World->addRigidBody(body, entry.group, entry.mask);
+        } else {
+            m_World->addCollisionObject(entry.object, entry.group, entry.mask);
+        }
+    }
+    // The solver randomizes the order of the constraints with its own seed
+    m_World->getConstraintSolver()->reset();
+}
+
 auto SimulationImplBullet::bullet_world() -> btDynamicsWorld& {
     if (m_World == nullptr) {
         throw std::runtime_error(
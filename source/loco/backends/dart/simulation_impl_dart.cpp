@@ -10,21 +10,48 @@
 
 #include <loco/backends/dart/simulation_impl_dart.hpp>
 
+#include <dart/collision/bullet/BulletCollisionDetector.hpp>
+#include <dart/collision/dart/DARTCollisionDetector.hpp>
+#include <dart/collision/fcl/FCLCollisionDetector.hpp>
 #include <dart/collision/ode/OdeCollisionDetector.hpp>
-//// #include <dart/collision/bullet/BulletCollisionDetector.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 
 namespace loco {
 namespace dart {
 
-SimulationImplDart::SimulationImplDart(core::Scenario::ptr scenario)
-    : SimulationImpl(std::move(scenario)) {
+namespace {
+/// Creates the DART collision detector for the given option (ODE by default)
+auto CreateCollisionDetector(eCollisionDetectorType detector_type)
+    -> ::dart::collision::CollisionDetectorPtr {
+    switch (detector_type) {
+        case eCollisionDetectorType::FCL:
+            return ::dart::collision::FCLCollisionDetector::create();
+        case eCollisionDetectorType::BULLET:
+            return ::dart::collision::BulletCollisionDetector::create();
+        case eCollisionDetectorType::DART:
+            return ::dart::collision::DARTCollisionDetector::create();
+        case eCollisionDetectorType::DEFAULT:
+        case eCollisionDetectorType::ODE:
+            break;
+    }
+    return ::dart::collision::OdeCollisionDetector::create();
+}
+}  // namespace
+
+SimulationImplDart::SimulationImplDart(core::Scenario::ptr scenario,
+                                       const SimulationConfig& config)
+    : SimulationImpl(std::move(scenario), config) {
     // Implement any required initial setup for the bullet backend
 }
 
 auto SimulationImplDart::Init() -> void {
     m_World = ::dart::simulation::World::create();
     m_World->getConstraintSolver()->setCollisionDetector(
-        ::dart::collision::OdeCollisionDetector::create());
+        CreateCollisionDetector(m_Config.collision_detector));
 }
 
 auto SimulationImplDart::Reset() -> void {
@@ -32,12 +59,39 @@ auto SimulationImplDart::Reset() -> void {
 }
 
 auto SimulationImplDart::Step(Scalar step) -> void {
-    if (m_World != nullptr) {
+    LOCO_PROFILE_SCOPE("SimulationImplDart::Step");
+    if (m_World == nullptr) {
+        return;
+    }
+
+    size_t substeps_taken = 0;
+    if (!m_Config.fixed_substeps) {
         auto time_start = m_World->getTime();
         while (m_World->getTime() - time_start < step) {
             m_World->step();
+            substeps_taken++;
+        }
+    } else {
+        substeps_taken = num_substeps(step);
+        for (size_t i = 0; i < substeps_taken; ++i) {
+            m_World->step();
         }
     }
+
+    m_Stats.num_substeps = substeps_taken;
+    m_Stats.num_contacts = m_World->getConstraintSolver()
+                               ->getLastCollisionResult()
+                               .getNumContacts();
+}
+
+auto SimulationImplDart::num_substeps(Scalar step) const -> size_t {
+    if (m_World == nullptr || m_World->getTimeStep() <= 0.0) {
+        return 0;
+    }
+    // Always take at least one substep, even if step < timestep
+    const auto NUM_SUBSTEPS = static_cast<int64_t>(std::llround(
+        static_cast<double>(step) / m_World->getTimeStep()));
+    return static_cast<size_t>(std::max<int64_t>(1, NUM_SUBSTEPS));
 }
 
 auto SimulationImplDart::SetTimeStep(Scalar step) -> void {
@@ -52,6 +106,68 @@ auto SimulationImplDart::SetGravity(const Vec3& gravity) -> void {
     }
 }
 
+auto SimulationImplDart::state_size() const -> size_t {
+    if (m_World == nullptr) {
+        return 0;
+    }
+    // time | (positions | velocities) of each skeleton
+    size_t num_dofs = 0;
+    for (size_t i = 0; i < m_World->getNumSkeletons(); ++i) {
+        num_dofs += m_World->getSkeleton(i)->getNumDofs();
+    }
+    return sizeof(double) * (1 + 2 * num_dofs);
+}
+
+auto SimulationImplDart::SaveState(uint8_t* buffer) const -> void {
+    if (m_World == nullptr) {
+        return;
+    }
+
+    // The buffer might not be aligned to doubles, so copy value by value
+    auto write = [&buffer](double value) {
+        memcpy(buffer, &value, sizeof(double));
+        buffer += sizeof(double);  // NOLINT
+    };
+
+    write(m_World->getTime());
+    for (size_t i = 0; i < m_World->getNumSkeletons(); ++i) {
+        const auto skeleton = m_World->getSkeleton(i);
+        const auto NUM_DOFS = skeleton->getNumDofs();
+        // Access dof-by-dof, as the vectorized API returns Eigen temporaries
+        for (size_t j = 0; j < NUM_DOFS; ++j) {
+            write(skeleton->getPosition(j));
+        }
+        for (size_t j = 0; j < NUM_DOFS; ++j) {
+            write(skeleton->getVelocity(j));
+        }
+    }
+}
+
+auto SimulationImplDart::LoadState(const uint8_t* buffer) -> void {
+    if (m_World == nullptr) {
+        return;
+    }
+
+    auto read = [&buffer]() -> double {
+        double value = 0.0;
+        memcpy(&value, buffer, sizeof(double));
+        buffer += sizeof(double);  // NOLINT
+        return value;
+    };
+
+    m_World->setTime(read());
+    for (size_t i = 0; i < m_World->getNumSkeletons(); ++i) {
+        auto skeleton = m_World->getSkeleton(i);
+        const auto NUM_DOFS = skeleton->getNumDofs();
+        for (size_t j = 0; j < NUM_DOFS; ++j) {
+            skeleton->setPosition(j, read());
+        }
+        for (size_t j = 0; j < NUM_DOFS; ++j) {
+            skeleton->setVelocity(j, read());
+        }
+    }
+}
+
 }  // namespace dart
 }  // namespace loco
 
@@ -9,6 +9,10 @@ auto MjcModelDeleter::operator()(mjModel* ptr) const -> void {
     }
 }
 
+auto CreateModelPtr(mjModel* model) -> MjcModelPtr {
+    return MjcModelPtr(model, MjcModelDeleter());
+}
+
 auto MjcDataDeleter::operator()(mjData* ptr) const -> void {
     if (ptr != nullptr) {
         mj_deleteData(ptr);
@@ -0,0 +1,93 @@
+#include <loco/backends/mujoco/data_pool_mujoco.hpp>
+
+#include <spdlog/fmt/bundled/format.h>
+
+#include <stdexcept>
+
+namespace loco {
+namespace mujoco {
+
+DataPoolMujoco::DataPoolMujoco(std::shared_ptr<const mjModel> model,
+                               size_t num_datas)
+    : m_Model(std::move(model)) {
+    if (m_Model == nullptr) {
+        throw std::runtime_error(
+            "DataPoolMujoco >>> Requires a valid compiled mjModel");
+    }
+
+    m_Datas.reserve(num_datas);
+    for (size_t i = 0; i < num_datas; ++i) {
+        auto* data = mj_makeData(m_Model.get());
+        if (data == nullptr) {
+            throw std::runtime_error(fmt::format(
+                "DataPoolMujoco >>> Couldn't allocate mjData {} of {}", i,
+                num_datas));
+        }
+        m_Datas.emplace_back(data);
+    }
+}
+
+auto DataPoolMujoco::CopyFrom(const mjData& src) -> void {
+    for (auto& data : m_Datas) {
+        mj_copyData(data.get(), m_Model.get(), &src);
+    }
+}
+
+auto DataPoolMujoco::ResetData(size_t index) -> void {
+    mj_resetData(m_Model.get(), &data(index));
+}
+
+auto DataPoolMujoco::ForEach(const DataFn& fn, core::ThreadPool* thread_pool)
+    -> void {
+    const auto& model = *m_Model;
+    if (thread_pool == nullptr) {
+        for (size_t i = 0; i < m_Datas.size(); ++i) {
+            fn(i, model, *m_Datas[i]);
+        }
+        return;
+    }
+    thread_pool->ParallelFor(m_Datas.size(),
+                             [&](size_t i) { fn(i, model, *m_Datas[i]); });
+}
+
+auto DataPoolMujoco::StepAll(size_t num_steps, core::ThreadPool* thread_pool)
+    -> void {
+    ForEach(
+        [num_steps](size_t, const mjModel& model, mjData& data) {
+            for (size_t k = 0; k < num_steps; ++k) {
+                mj_step(&model, &data);
+            }
+        },
+        thread_pool);
+}
+
+auto DataPoolMujoco::data(size_t index) -> mjData& {
+    if (index >= m_Datas.size()) {
+        throw std::runtime_error(fmt::format(
+            "DataPoolMujoco::data >>> Index {} out of range (size={})", index,
+            m_Datas.size()));
+    }
+    return *m_Datas[index];
+}
+
+auto DataPoolMujoco::data(size_t index) const -> const mjData& {
+    if (index >= m_Datas.size()) {
+        throw std::runtime_error(fmt::format(
+            "DataPoolMujoco::data >>> Index {} out of range (size={})", index,
+            m_Datas.size()));
+    }
+    return *m_Datas[index];
+}
+
+auto DataPoolMujoco::ToString() const -> std::string {
+    return fmt::format(
+        "<DataPoolMujoco\n"
+        "  size={}\n"
+        "  nq={}\n"
+        "  nv={}\n"
+        ">",
+        m_Datas.size(), m_Model->nq, m_Model->nv);
+}
+
+}  // namespace mujoco
+}  // namespace loco
@@ -1,11 +1,55 @@
 #include <loco/backends/mujoco/simulation_impl_mujoco.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
 namespace loco {
 namespace mujoco {
 
-SimulationImplMujoco::SimulationImplMujoco(core::Scenario::ptr scenario)
-    : SimulationImpl(std::move(scenario)) {
-    // Implement any required initial setup for the bullet backend
+namespace {
+/// Timer callback used by MuJoCo's profiler, in seconds of wall-clock time
+auto WallTimeSeconds() -> mjtNum {
+    return std::chrono::duration<mjtNum>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/// Copies the given array of mjtNum into the buffer, advancing its cursor
+auto WriteArray(uint8_t*& cursor, const mjtNum* src, size_t count) -> void {
+    const auto NUM_BYTES = sizeof(mjtNum) * count;
+    memcpy(cursor, src, NUM_BYTES);
+    cursor += NUM_BYTES;  // NOLINT
+}
+
+/// Copies from the buffer into the given array of mjtNum, advancing its cursor
+auto ReadArray(const uint8_t*& cursor, mjtNum* dst, size_t count) -> void {
+    const auto NUM_BYTES = sizeof(mjtNum) * count;
+    memcpy(dst, cursor, NUM_BYTES);
+    cursor += NUM_BYTES;  // NOLINT
+}
+
+/// Returns the number of mjtNum that compose the state of the given model
+auto NumStateScalars(const mjModel& model) -> size_t {
+    // time | qpos | qvel | act | qacc_warmstart | ctrl | qfrc_applied |
+    // xfrc_applied
+    return static_cast<size_t>(1 + model.nq + 2 * model.nv + model.na +
+                               model.nu + model.nv + 6 * model.nbody);
+}
+}  // namespace
+
+SimulationImplMujoco::SimulationImplMujoco(core::Scenario::ptr scenario,
+                                           const SimulationConfig& config)
+    : SimulationImpl(std::move(scenario), config),
+      m_FixedSubsteps(config.fixed_substeps) {
+    // MuJoCo only fills its timers if a timer callback is installed. As it's
+    // process-wide, only install it if asked to, and keep any user callback
+    if (config.profile_phases && mjcb_time == nullptr) {
+        mjcb_time = WallTimeSeconds;
+    }
 }
 
 auto SimulationImplMujoco::Init() -> void {
@@ -17,15 +61,63 @@ auto SimulationImplMujoco::Reset() -> void {
 }
 
 auto SimulationImplMujoco::Step(Scalar step) -> void {
+    LOCO_PROFILE_SCOPE("SimulationImplMujoco::Step");
     if (m_Model == nullptr || m_Data == nullptr) {
         return;
     }
 
-    mjtNum sim_start = m_Data->time;
-    while (m_Data->time - sim_start < static_cast<mjtNum>(step)) {
-        // Take a step in the simulation
-        mj_step(m_Model.get(), m_Data.get());
+    // MuJoCo's timers are cumulative, so keep track of their previous values
+    const auto COLLISION_START = m_Data->timer[mjTIMER_POS_COLLISION].duration;
+    const auto SOLVER_START = m_Data->timer[mjTIMER_CONSTRAINT].duration;
+
+    size_t substeps_taken = 0;
+    if (!m_FixedSubsteps) {
+        mjtNum sim_start = m_Data->time;
+        while (m_Data->time - sim_start < static_cast<mjtNum>(step)) {
+            // Take a step in the simulation
+            mj_step(m_Model.get(), m_Data.get());
+            substeps_taken++;
+        }
+    } else {
+        substeps_taken = num_substeps(step);
+        for (size_t i = 0; i < substeps_taken; ++i) {
+            // Position and velocity dependent computations
+            mj_step1(m_Model.get(), m_Data.get());
+            if (m_ControlCallback) {
+                m_ControlCallback(*m_Model, *m_Data);
+            }
+            // Force, acceleration dependent computations, and integration
+            mj_step2(m_Model.get(), m_Data.get());
+        }
+    }
+
+    m_Stats.num_substeps = substeps_taken;
+    m_Stats.num_contacts = static_cast<size_t>(m_Data->ncon);
+    m_Stats.num_constraint_rows = static_cast<size_t>(m_Data->nefc);
+    m_Stats.num_broadphase_pairs = static_cast<size_t>(m_Data->nbodypair_broad);
+    m_Stats.collision_time =
+        m_Data->timer[mjTIMER_POS_COLLISION].duration - COLLISION_START;
+    m_Stats.solver_time =
+        m_Data->timer[mjTIMER_CONSTRAINT].duration - SOLVER_START;
+}
+
+auto SimulationImplMujoco::SetFixedSubsteps(bool enabled) -> void {
+    m_FixedSubsteps = enabled;
+}
+
+auto SimulationImplMujoco::SetControlCallback(ControlCallback callback)
+    -> void {
+    m_ControlCallback = std::move(callback);
+}
+
+auto SimulationImplMujoco::num_substeps(Scalar step) const -> size_t {
+    if (m_Model == nullptr || m_Model->opt.timestep <= 0.0) {
+        return 0;
     }
+    // Always take at least one substep, even if step < timestep
+    const auto NUM_SUBSTEPS = static_cast<int64_t>(
+        std::llround(static_cast<mjtNum>(step) / m_Model->opt.timestep));
+    return static_cast<size_t>(std::max<int64_t>(1, NUM_SUBSTEPS));
 }
 
 auto SimulationImplMujoco::SetTimeStep(Scalar fixed_step) -> void {
@@ -46,6 +138,81 @@ auto SimulationImplMujoco::SetGravity(const Vec3& gravity) -> void {
     m_Model->opt.gravity[2] = static_cast<mjtNum>(gravity.z());
 }
 
+auto SimulationImplMujoco::state_size() const -> size_t {
+    if (m_Model == nullptr || m_Data == nullptr) {
+        return 0;
+    }
+    return sizeof(mjtNum) * NumStateScalars(*m_Model);
+}
+
+auto SimulationImplMujoco::SaveState(uint8_t* buffer) const -> void {
+    if (m_Model == nullptr || m_Data == nullptr) {
+        return;
+    }
+
+    const auto& model = *m_Model;
+    const auto& data = *m_Data;
+    auto* cursor = buffer;
+    WriteArray(cursor, &data.time, 1);
+    WriteArray(cursor, data.qpos, static_cast<size_t>(model.nq));
+    WriteArray(cursor, data.qvel, static_cast<size_t>(model.nv));
+    WriteArray(cursor, data.act, static_cast<size_t>(model.na));
+    WriteArray(cursor, data.qacc_warmstart, static_cast<size_t>(model.nv));
+    WriteArray(cursor, data.ctrl, static_cast<size_t>(model.nu));
+    WriteArray(cursor, data.qfrc_applied, static_cast<size_t>(model.nv));
+    WriteArray(cursor, data.xfrc_applied, static_cast<size_t>(6 * model.nbody));
+}
+
+auto SimulationImplMujoco::LoadState(const uint8_t* buffer) -> void {
+    if (m_Model == nullptr || m_Data == nullptr) {
+        return;
+    }
+
+    const auto& model = *m_Model;
+    auto& data = *m_Data;
+    const auto* cursor = buffer;
+    ReadArray(cursor, &data.time, 1);
+    ReadArray(cursor, data.qpos, static_cast<size_t>(model.nq));
+    ReadArray(cursor, data.qvel, static_cast<size_t>(model.nv));
+    ReadArray(cursor, data.act, static_cast<size_t>(model.na));
+    ReadArray(cursor, data.qacc_warmstart, static_cast<size_t>(model.nv));
+    ReadArray(cursor, data.ctrl, static_cast<size_t>(model.nu));
+    ReadArray(cursor, data.qfrc_applied, static_cast<size_t>(model.nv));
+    ReadArray(cursor, data.xfrc_applied, static_cast<size_t>(6 * model.nbody));
+
+    // Recompute the derived quantities (uses mjData's own stack, no allocs)
+    mj_forward(m_Model.get(), m_Data.get());
+}
+
+auto SimulationImplMujoco::CreateDataPool(size_t num_datas) const
+    -> DataPoolMujoco::uptr {
+    if (m_Model == nullptr || m_Data == nullptr) {
+        throw std::runtime_error(
+            "SimulationImplMujoco::CreateDataPool >>> Must initialize the "
+            "backend first before creating a pool of mjData");
+    }
+    auto pool = std::make_unique<DataPoolMujoco>(m_Model, num_datas);
+    pool->CopyFrom(*m_Data);
+    return pool;
+}
+
+auto SimulationImplMujoco::_SetModel(mjModel* model) -> void {
+    if (model == nullptr) {
+        throw std::runtime_error(
+            "SimulationImplMujoco::_SetModel >>> Requires a valid compiled "
+            "mjModel");
+    }
+    // Release the data before the model it was created for
+    m_Data = nullptr;
+    m_Model = CreateModelPtr(model);
+    m_Data = std::unique_ptr<mjData, MjcDataDeleter>(mj_makeData(model));
+    if (m_Data == nullptr) {
+        throw std::runtime_error(
+            "SimulationImplMujoco::_SetModel >>> Couldn't allocate the mjData "
+            "of the model");
+    }
+}
+
 auto SimulationImplMujoco::mujoco_model() -> mjModel& {
     if (m_Model == nullptr) {
         throw std::runtime_error(
@@ -0,0 +1,335 @@
+#include <loco/core/asset_cache_t.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+namespace loco {
+namespace core {
+
+namespace {
+/// Weak reference to the buffers of a unique mesh
+struct CachedMesh {
+    /// Number of vertices of the mesh
+    size_t n_vertices = 0;
+    /// Number of faces of the mesh
+    size_t n_faces = 0;
+    /// Storage of the vertices (3 scalars per vertex)
+    std::weak_ptr<Scalar> vertices;
+    /// Storage of the faces (3 indices per face)
+    std::weak_ptr<uint32_t> faces;
+
+    /// Returns whether the buffers of the mesh were released
+    auto expired() const -> bool {
+        return vertices.expired() || (n_faces > 0 && faces.expired());
+    }
+};
+
+/// Weak reference to the buffer of a unique heightfield
+struct CachedHeightfield {
+    /// Number of samples along the width of the heightfield
+    size_t n_width_samples = 0;
+    /// Number of samples along the depth of the heightfield
+    size_t n_depth_samples = 0;
+    /// Storage of the heights
+    std::weak_ptr<Scalar> heights;
+
+    /// Returns whether the buffer of the heightfield was released
+    auto expired() const -> bool { return heights.expired(); }
+};
+
+/// Entries of the cache, protected by a single mutex
+struct AssetCacheState {
+    /// Mutex used to protect the entries of the cache
+    std::mutex mutex;
+    /// Unique meshes (identical keys might still be different meshes)
+    std::unordered_multimap<AssetCache::Key, CachedMesh> meshes;
+    /// Unique heightfields (identical keys might still be different hfields)
+    std::unordered_multimap<AssetCache::Key, CachedHeightfield> hfields;
+    /// Backend geometries, by key of the asset they're built from and type
+    std::map<std::pair<AssetCache::Key, std::type_index>, std::weak_ptr<void>>
+        geometries;
+    /// Number of entries left after the last sweep of expired entries
+    size_t num_entries_swept = 0;
+};
+
+/// Min. number of entries before the cache is swept for expired entries
+constexpr size_t MIN_ENTRIES_TO_SWEEP = 64;
+
+/// Returns the state of the cache (created on first use)
+auto GetState() -> AssetCacheState& {
+    static AssetCacheState s_State;
+    return s_State;
+}
+
+/// Mixes the given bytes into the given hash (64 bits at a time)
+auto HashBytes(uint64_t hash, const void* data, size_t num_bytes) -> uint64_t {
+    constexpr uint64_t PRIME = 0x100000001b3ULL;
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= num_bytes; i += sizeof(uint64_t)) {
+        uint64_t word = 0;
+        memcpy(&word, bytes + i, sizeof(uint64_t));
+        hash = (hash ^ word) * PRIME;
+        hash ^= hash >> 29U;
+    }
+    for (; i < num_bytes; ++i) {
+        hash = (hash ^ bytes[i]) * PRIME;
+    }
+    return hash;
+}
+
+/// Seed of all hashes (FNV-1a offset basis)
+constexpr uint64_t HASH_SEED = 0xcbf29ce484222325ULL;
+
+/// Returns the given hash, remapped so it never collides with the empty key
+auto ToKey(uint64_t hash) -> AssetCache::Key {
+    return (hash == 0) ? 1 : hash;
+}
+
+/// Returns whether the given storages have the same elements
+template <typename T>
+auto SameContents(const T* lhs, const T* rhs, size_t size) -> bool {
+    return lhs == rhs || memcmp(lhs, rhs, sizeof(T) * size) == 0;
+}
+
+/// Drops the expired entries of the given container
+template <typename Container>
+auto EraseExpired(Container& entries) -> size_t {
+    size_t num_erased = 0;
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (it->second.expired()) {
+            it = entries.erase(it);
+            num_erased++;
+        } else {
+            ++it;
+        }
+    }
+    return num_erased;
+}
+
+/// Returns the number of entries still alive in the given container
+template <typename Container>
+auto CountAlive(const Container& entries) -> size_t {
+    size_t num_alive = 0;
+    for (const auto& entry : entries) {
+        num_alive += entry.second.expired() ? 0 : 1;
+    }
+    return num_alive;
+}
+
+/// Drops the expired entries of the cache (its lock must be held)
+auto SweepExpired(AssetCacheState& state) -> size_t {
+    const auto NUM_ERASED = EraseExpired(state.meshes) +
+                            EraseExpired(state.hfields) +
+                            EraseExpired(state.geometries);
+    state.num_entries_swept =
+        state.meshes.size() + state.hfields.size() + state.geometries.size();
+    return NUM_ERASED;
+}
+
+/// Sweeps the cache if it doubled its size since the last sweep, so expired
+/// entries don't pile up (e.g. with assets created per episode), at an
+/// amortized O(1) cost per insertion (its lock must be held)
+auto SweepIfGrown(AssetCacheState& state) -> void {
+    const auto NUM_ENTRIES =
+        state.meshes.size() + state.hfields.size() + state.geometries.size();
+    if (NUM_ENTRIES >=
+        std::max(MIN_ENTRIES_TO_SWEEP, 2 * state.num_entries_swept)) {
+        SweepExpired(state);
+    }
+}
+}  // namespace
+
+auto AssetCache::Share(MeshData& mesh_data) -> Key {
+    if (mesh_data.n_vertices == 0 || mesh_data.vertices == nullptr) {
+        return 0;
+    }
+    const auto KEY = ComputeKey(mesh_data);
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto range = state.meshes.equal_range(KEY);
+    for (auto it = range.first; it != range.second;) {
+        const auto& cached = it->second;
+        auto vertices = cached.vertices.lock();
+        auto faces = cached.faces.lock();
+        if (vertices == nullptr || (cached.n_faces > 0 && faces == nullptr)) {
+            it = state.meshes.erase(it);
+            continue;
+        }
+        if (cached.n_vertices == mesh_data.n_vertices &&
+            cached.n_faces == mesh_data.n_faces &&
+            SameContents(vertices.get(), mesh_data.vertices.get(),
+                         3 * mesh_data.n_vertices) &&
+            SameContents(faces.get(), mesh_data.faces.get(),
+                         3 * mesh_data.n_faces)) {
+            mesh_data.vertices = SharedBuffer<Scalar>(
+                std::move(vertices), mesh_data.vertices.size());
+            mesh_data.faces = SharedBuffer<uint32_t>(std::move(faces),
+                                                     mesh_data.faces.size());
+            return KEY;
+        }
+        ++it;
+    }
+    CachedMesh entry;
+    entry.n_vertices = mesh_data.n_vertices;
+    entry.n_faces = mesh_data.n_faces;
+    entry.vertices = mesh_data.vertices.weak();
+    entry.faces = mesh_data.faces.weak();
+    state.meshes.emplace(KEY, std::move(entry));
+    SweepIfGrown(state);
+    return KEY;
+}
+
+auto AssetCache::Share(HeightfieldData& hfield_data) -> Key {
+    const auto N_SAMPLES =
+        hfield_data.n_width_samples * hfield_data.n_depth_samples;
+    if (N_SAMPLES == 0 || hfield_data.heights == nullptr) {
+        return 0;
+    }
+    const auto KEY = ComputeKey(hfield_data);
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto range = state.hfields.equal_range(KEY);
+    for (auto it = range.first; it != range.second;) {
+        const auto& cached = it->second;
+        auto heights = cached.heights.lock();
+        if (heights == nullptr) {
+            it = state.hfields.erase(it);
+            continue;
+        }
+        if (cached.n_width_samples == hfield_data.n_width_samples &&
+            cached.n_depth_samples == hfield_data.n_depth_samples &&
+            SameContents(heights.get(), hfield_data.heights.get(),
+                         N_SAMPLES)) {
+            hfield_data.heights = SharedBuffer<Scalar>(
+                std::move(heights), hfield_data.heights.size());
+            return KEY;
+        }
+        ++it;
+    }
+    CachedHeightfield entry;
+    entry.n_width_samples = hfield_data.n_width_samples;
+    entry.n_depth_samples = hfield_data.n_depth_samples;
+    entry.heights = hfield_data.heights.weak();
+    state.hfields.emplace(KEY, std::move(entry));
+    SweepIfGrown(state);
+    return KEY;
+}
+
+auto AssetCache::Share(ShapeData& shape_data) -> Key {
+    switch (shape_data.type) {
+        case eShapeType::CONVEX_MESH:
+        case eShapeType::TRIANGULAR_MESH:
+            return Share(shape_data.mesh_data);
+        case eShapeType::HEIGHTFIELD:
+            return Share(shape_data.hfield_data);
+        default:
+            return 0;
+    }
+}
+
+auto AssetCache::ShareIfLoaded(ShapeData& shape_data) -> Key {
+    switch (shape_data.type) {
+        case eShapeType::CONVEX_MESH:
+        case eShapeType::TRIANGULAR_MESH:
+            return shape_data.mesh_data.filepath.empty()
+                       ? 0
+                       : Share(shape_data.mesh_data);
+        default:
+            return 0;
+    }
+}
+
+auto AssetCache::ComputeKey(const MeshData& mesh_data) -> Key {
+    const uint64_t DIMS[] = {mesh_data.n_vertices,  // NOLINT
+                             mesh_data.n_faces};
+    auto hash = HashBytes(HASH_SEED, DIMS, sizeof(DIMS));
+    hash = HashBytes(hash, mesh_data.vertices.get(),
+                     sizeof(Scalar) * 3 * mesh_data.n_vertices);
+    hash = HashBytes(hash, mesh_data.faces.get(),
+                     sizeof(uint32_t) * 3 * mesh_data.n_faces);
+    return ToKey(hash);
+}
+
+auto AssetCache::ComputeKey(const HeightfieldData& hfield_data) -> Key {
+    const uint64_t DIMS[] = {hfield_data.n_width_samples,  // NOLINT
+                             hfield_data.n_depth_samples};
+    auto hash = HashBytes(HASH_SEED, DIMS, sizeof(DIMS));
+    hash = HashBytes(hash, hfield_data.heights.get(),
+                     sizeof(Scalar) * hfield_data.n_width_samples *
+                         hfield_data.n_depth_samples);
+    return ToKey(hash);
+}
+
+auto AssetCache::Prune() -> size_t {
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return SweepExpired(state);
+}
+
+auto AssetCache::Clear() -> void {
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.meshes.clear();
+    state.hfields.clear();
+    state.geometries.clear();
+    state.num_entries_swept = 0;
+}
+
+auto AssetCache::num_meshes() -> size_t {
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return CountAlive(state.meshes);
+}
+
+auto AssetCache::num_hfields() -> size_t {
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return CountAlive(state.hfields);
+}
+
+auto AssetCache::num_geometries() -> size_t {
+    auto& state = GetState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return CountAlive(state.geometries);
+}
+
+auto AssetCache::_GetOrCreate(
+    Key key, std::type_index type,
+    const std::function<std::shared_ptr<void>()>& create)
+    -> std::shared_ptr<void> {
+    auto& state = GetState();
+    const auto ENTRY_KEY = std::make_pair(key, type);
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        auto it = state.geometries.find(ENTRY_KEY);
+        if (it != state.geometries.end()) {
+            auto geometry = it->second.lock();
+            if (geometry != nullptr) {
+                return geometry;
+            }
+        }
+    }
+    // Cook the geometry without holding the lock (it might take a while, and
+    // might use the cache itself). If another thread cooked the same geometry
+    // in the meantime, keep the first one, so all users share the same one
+    auto geometry = create();
+    if (geometry == nullptr) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto& entry = state.geometries[ENTRY_KEY];
+    auto existing = entry.lock();
+    if (existing != nullptr) {
+        return existing;
+    }
+    entry = geometry;
+    SweepIfGrown(state);
+    return geometry;
+}
+
+}  // namespace core
+}  // namespace loco
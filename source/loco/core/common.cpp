@@ -1,5 +1,10 @@
 #include <loco/core/common.hpp>
 
+#include <cstring>
+#include <stdexcept>
+
+#include <spdlog/fmt/bundled/format.h>
+
 namespace loco {
 
 auto ToString(const eBackendType& backend_type) -> std::string {
@@ -60,4 +65,63 @@ auto ToString(const eDynamicsType& dyn_type) -> std::string {
     }
 }
 
+auto ToString(const eCollisionDetectorType& detector_type) -> std::string {
+    switch (detector_type) {
+        case eCollisionDetectorType::DEFAULT:
+            return "default";
+        case eCollisionDetectorType::FCL:
+            return "fcl";
+        case eCollisionDetectorType::ODE:
+            return "ode";
+        case eCollisionDetectorType::BULLET:
+            return "bullet";
+        case eCollisionDetectorType::DART:
+            return "dart";
+    }
+}
+
+auto ToString(const eTaskSchedulerType& scheduler_type) -> std::string {
+    switch (scheduler_type) {
+        case eTaskSchedulerType::STD_THREAD:
+            return "std_thread";
+        case eTaskSchedulerType::OPENMP:
+            return "openmp";
+        case eTaskSchedulerType::TBB:
+            return "tbb";
+    }
+}
+
+auto WriteElevationRegion(HeightfieldData& hfield_data,
+                          const HeightfieldRegion& region,
+                          const Scalar* ptr_heights) -> void {
+    if (region.width_start + region.n_width_samples >
+            hfield_data.n_width_samples ||
+        region.depth_start + region.n_depth_samples >
+            hfield_data.n_depth_samples) {
+        throw std::runtime_error(fmt::format(
+            "WriteElevationRegion >>> Region [{}:{}, {}:{}] out of bounds of "
+            "heightfield with {}x{} samples",
+            region.width_start, region.width_start + region.n_width_samples,
+            region.depth_start, region.depth_start + region.n_depth_samples,
+            hfield_data.n_width_samples, hfield_data.n_depth_samples));
+    }
+    if (region.n_width_samples == 0 || region.n_depth_samples == 0) {
+        return;
+    }
+    // Heightfields with no elevation data yet (or not enough for the grid)
+    // get zeroed storage, as ChangeElevationData does when resizing
+    const auto N_GRID_SAMPLES =
+        hfield_data.n_width_samples * hfield_data.n_depth_samples;
+    if (hfield_data.heights.size() != N_GRID_SAMPLES) {
+        hfield_data.heights = SharedBuffer<Scalar>(N_GRID_SAMPLES);
+    }
+    auto* heights = hfield_data.heights.mutable_data();
+    for (size_t row = 0; row < region.n_depth_samples; ++row) {
+        memcpy(heights + region.width_start +
+                   (region.depth_start + row) * hfield_data.n_width_samples,
+               ptr_heights + row * region.n_width_samples,
+               sizeof(Scalar) * region.n_width_samples);
+    }
+}
+
 }  // namespace loco
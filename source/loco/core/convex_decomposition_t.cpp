@@ -0,0 +1,674 @@
+#include <loco/core/convex_decomposition_t.hpp>
+
+#include <spdlog/fmt/bundled/format.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace loco {
+namespace core {
+
+namespace {
+/// Points are processed in double precision, to keep the hulls robust
+using Point = std::array<double, 3>;
+
+auto Sub(const Point& a, const Point& b) -> Point {
+    return {a[0] - b[0], a[1] - b[1], a[2] - b[2]};
+}
+
+auto Dot(const Point& a, const Point& b) -> double {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+auto Cross(const Point& a, const Point& b) -> Point {
+    return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2],
+            a[0] * b[1] - a[1] * b[0]};
+}
+
+auto Length(const Point& a) -> double { return std::sqrt(Dot(a, a)); }
+
+/// Relative tolerance used to decide whether a point is outside a face
+constexpr double RELATIVE_EPSILON = 1e-7;
+
+/// Triangle of a hull, with its supporting plane (dot(normal, p) = offset)
+struct HullFace {
+    /// Indices of the vertices of the face (counter-clockwise from outside)
+    std::array<size_t, 3> v;  // NOLINT
+    /// Outward unit normal of the plane of the face
+    Point normal;
+    /// Offset of the plane of the face along its normal
+    double offset = 0.0;
+    /// Points in front of this face, not yet added to the hull
+    std::vector<size_t> outside;
+    /// The outside point farthest from the face
+    size_t farthest = 0;
+    /// Distance from the face to its farthest outside point
+    double farthest_dist = 0.0;
+    /// Whether the face is still part of the hull
+    bool alive = true;
+
+    /// Returns the signed distance from the plane of the face to a point
+    auto Distance(const Point& p) const -> double {
+        return Dot(normal, p) - offset;
+    }
+};
+
+/// Result of the quickhull algorithm
+struct HullResult {
+    /// Whether the points were all coplanar (no hull faces then)
+    bool degenerate = true;
+    /// The faces of the hull (indices into the given points)
+    std::vector<HullFace> faces;
+};
+
+/// Returns the diagonal of the bounding box of the given points
+auto BoundingDiagonal(const std::vector<Point>& points) -> double {
+    if (points.empty()) {
+        return 0.0;
+    }
+    Point lower = points[0];
+    Point upper = points[0];
+    for (const auto& p : points) {
+        for (size_t k = 0; k < 3; ++k) {
+            lower[k] = std::min(lower[k], p[k]);
+            upper[k] = std::max(upper[k], p[k]);
+        }
+    }
+    return Length(Sub(upper, lower));
+}
+
+/// Returns a face over the given vertices (normal following their winding)
+auto MakeFace(const std::vector<Point>& points, size_t a, size_t b, size_t c)
+    -> HullFace {
+    HullFace face;
+    face.v = {a, b, c};
+    auto normal = Cross(Sub(points[b], points[a]), Sub(points[c], points[a]));
+    auto length = Length(normal);
+    if (length > 0.0) {
+        face.normal = {normal[0] / length, normal[1] / length,
+                       normal[2] / length};
+        face.offset = Dot(face.normal, points[a]);
+    } else {
+        face.normal = {0.0, 0.0, 0.0};
+    }
+    return face;
+}
+
+/// Returns the key of the directed edge a->b in the edge map
+auto EdgeKey(size_t a, size_t b) -> uint64_t {
+    return (static_cast<uint64_t>(a) << 32U) | static_cast<uint64_t>(b);
+}
+
+/// \brief Computes the convex hull of the given points (quickhull)
+///
+/// Every iteration adds the point farthest from the hull, so stopping at a
+/// vertex limit keeps the points that contribute the most to the hull
+auto QuickHull(const std::vector<Point>& points, size_t max_vertices)
+    -> HullResult {
+    HullResult result;
+    if (points.size() < 4) {
+        return result;
+    }
+    const auto EPSILON = RELATIVE_EPSILON * BoundingDiagonal(points);
+
+    // Initial simplex: the two farthest extremes along the axes, the point
+    // farthest from their line, and the point farthest from their plane
+    std::array<size_t, 6> extremes{};
+    for (size_t i = 0; i < points.size(); ++i) {
+        for (size_t k = 0; k < 3; ++k) {
+            if (points[i][k] < points[extremes[2 * k]][k]) {
+                extremes[2 * k] = i;
+            }
+            if (points[i][k] > points[extremes[2 * k + 1]][k]) {
+                extremes[2 * k + 1] = i;
+            }
+        }
+    }
+    size_t i0 = 0;
+    size_t i1 = 0;
+    double max_dist = 0.0;
+    for (auto a : extremes) {
+        for (auto b : extremes) {
+            auto dist = Length(Sub(points[a], points[b]));
+            if (dist > max_dist) {
+                max_dist = dist;
+                i0 = a;
+                i1 = b;
+            }
+        }
+    }
+    if (max_dist <= EPSILON) {
+        return result;
+    }
+
+    size_t i2 = 0;
+    max_dist = 0.0;
+    const auto DIR = Sub(points[i1], points[i0]);
+    for (size_t i = 0; i < points.size(); ++i) {
+        auto dist = Length(Cross(Sub(points[i], points[i0]), DIR)) /
+                    Length(DIR);
+        if (dist > max_dist) {
+            max_dist = dist;
+            i2 = i;
+        }
+    }
+    if (max_dist <= EPSILON) {
+        return result;
+    }
+
+    size_t i3 = 0;
+    max_dist = 0.0;
+    const auto BASE = MakeFace(points, i0, i1, i2);
+    for (size_t i = 0; i < points.size(); ++i) {
+        auto dist = std::abs(BASE.Distance(points[i]));
+        if (dist > max_dist) {
+            max_dist = dist;
+            i3 = i;
+        }
+    }
+    if (max_dist <= EPSILON) {
+        return result;
+    }
+    result.degenerate = false;
+
+    auto& faces = result.faces;
+    std::unordered_map<uint64_t, size_t> edge_to_face;
+    auto add_face = [&](HullFace face) -> size_t {
+        const auto FACE_ID = faces.size();
+        for (size_t e = 0; e < 3; ++e) {
+            edge_to_face[EdgeKey(face.v[e], face.v[(e + 1) % 3])] = FACE_ID;
+        }
+        faces.push_back(std::move(face));
+        return FACE_ID;
+    };
+
+    // Orient the faces of the simplex so they face away from its centroid
+    Point centroid{};
+    for (auto i : {i0, i1, i2, i3}) {
+        for (size_t k = 0; k < 3; ++k) {
+            centroid[k] += points[i][k] / 4.0;
+        }
+    }
+    const std::array<std::array<size_t, 3>, 4> SIMPLEX = {
+        {{i0, i1, i2}, {i0, i1, i3}, {i0, i2, i3}, {i1, i2, i3}}};
+    for (const auto& tri : SIMPLEX) {
+        auto face = MakeFace(points, tri[0], tri[1], tri[2]);
+        if (face.Distance(centroid) > 0.0) {
+            face = MakeFace(points, tri[0], tri[2], tri[1]);
+        }
+        add_face(std::move(face));
+    }
+
+    // Assigns the given point to the face it's farthest in front of (if any)
+    auto assign_point = [&](size_t point, size_t first_face) {
+        double best_dist = EPSILON;
+        size_t best_face = faces.size();
+        for (size_t f = first_face; f < faces.size(); ++f) {
+            auto dist = faces[f].Distance(points[point]);
+            if (faces[f].alive && dist > best_dist) {
+                best_dist = dist;
+                best_face = f;
+            }
+        }
+        if (best_face < faces.size()) {
+            auto& face = faces[best_face];
+            if (face.outside.empty() || best_dist > face.farthest_dist) {
+                face.farthest = point;
+                face.farthest_dist = best_dist;
+            }
+            face.outside.push_back(point);
+        }
+    };
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (i != i0 && i != i1 && i != i2 && i != i3) {
+            assign_point(i, 0);
+        }
+    }
+
+    size_t num_vertices = 4;
+    std::vector<uint8_t> visible;
+    std::vector<size_t> stack;
+    std::vector<std::pair<size_t, size_t>> horizon;
+    std::vector<size_t> orphans;
+    while (max_vertices == 0 || num_vertices < max_vertices) {
+        // Pick the point farthest from the hull, among the farthest point of
+        // each face (kept up to date while assigning points to faces)
+        size_t face_id = faces.size();
+        for (size_t f = 0; f < faces.size(); ++f) {
+            if (faces[f].alive && !faces[f].outside.empty() &&
+                (face_id == faces.size() ||
+                 faces[f].farthest_dist > faces[face_id].farthest_dist)) {
+                face_id = f;
+            }
+        }
+        if (face_id == faces.size()) {
+            break;
+        }
+        const auto EYE = faces[face_id].farthest;
+        const auto& eye_point = points[EYE];
+
+        // Collect the faces visible from the eye point, and their horizon
+        visible.assign(faces.size(), 0);
+        visible[face_id] = 1;
+        stack.assign(1, face_id);
+        horizon.clear();
+        orphans.clear();
+        while (!stack.empty()) {
+            auto current = stack.back();
+            stack.pop_back();
+            for (size_t e = 0; e < 3; ++e) {
+                auto a = faces[current].v[e];
+                auto b = faces[current].v[(e + 1) % 3];
+                auto it = edge_to_face.find(EdgeKey(b, a));
+                if (it == edge_to_face.end()) {
+                    horizon.emplace_back(a, b);
+                    continue;
+                }
+                auto neighbor = it->second;
+                if (visible[neighbor] == 1) {
+                    continue;
+                }
+                if (faces[neighbor].Distance(eye_point) > EPSILON) {
+                    visible[neighbor] = 1;
+                    stack.push_back(neighbor);
+                } else {
+                    horizon.emplace_back(a, b);
+                }
+            }
+        }
+
+        // Remove the visible faces, keeping their points to reassign them
+        for (size_t f = 0; f < visible.size(); ++f) {
+            if (visible[f] == 0) {
+                continue;
+            }
+            faces[f].alive = false;
+            for (auto point : faces[f].outside) {
+                if (point != EYE) {
+                    orphans.push_back(point);
+                }
+            }
+            faces[f].outside.clear();
+            faces[f].outside.shrink_to_fit();
+            for (size_t e = 0; e < 3; ++e) {
+                auto key = EdgeKey(faces[f].v[e], faces[f].v[(e + 1) % 3]);
+                auto it = edge_to_face.find(key);
+                if (it != edge_to_face.end() && it->second == f) {
+                    edge_to_face.erase(it);
+                }
+            }
+        }
+
+        // Connect the horizon to the eye point, and reassign the orphans
+        const auto FIRST_NEW_FACE = faces.size();
+        for (const auto& edge : horizon) {
+            add_face(MakeFace(points, edge.first, edge.second, EYE));
+        }
+        for (auto point : orphans) {
+            assign_point(point, FIRST_NEW_FACE);
+        }
+        num_vertices++;
+    }
+
+    auto is_dead = [](const HullFace& face) { return !face.alive; };
+    faces.erase(std::remove_if(faces.begin(), faces.end(), is_dead),
+                faces.end());
+    return result;
+}
+
+/// \brief Computes the hull of the given points, with corner vertices only
+///
+/// Points lying on edges or faces of the hull (e.g. picked for the initial
+/// simplex) are dropped, as they don't change the shape of the hull. Such
+/// vertices have less than 3 distinct planes among their adjacent faces
+auto QuickHullCorners(std::vector<Point>& points, size_t max_vertices)
+    -> HullResult {
+    constexpr double PARALLEL_EPSILON = 1e-9;
+    auto hull = QuickHull(points, max_vertices);
+    while (!hull.degenerate) {
+        std::vector<std::vector<Point>> planes(points.size());
+        for (const auto& face : hull.faces) {
+            for (auto v : face.v) {
+                auto& vertex_planes = planes[v];
+                auto is_new = std::none_of(
+                    vertex_planes.begin(), vertex_planes.end(),
+                    [&face](const Point& normal) {
+                        return Dot(normal, face.normal) >
+                               1.0 - PARALLEL_EPSILON;
+                    });
+                if (is_new && vertex_planes.size() < 3) {
+                    vertex_planes.push_back(face.normal);
+                }
+            }
+        }
+        std::vector<Point> corners;
+        bool has_non_corners = false;
+        for (size_t i = 0; i < points.size(); ++i) {
+            if (planes[i].size() == 3) {
+                corners.push_back(points[i]);
+            } else if (!planes[i].empty()) {
+                has_non_corners = true;
+            }
+        }
+        if (!has_non_corners) {
+            break;
+        }
+        points = std::move(corners);
+        hull = QuickHull(points, max_vertices);
+    }
+    return hull;
+}
+
+/// Throws if any face of the given mesh uses a vertex it doesn't have
+auto ValidateFaces(const MeshData& mesh_data, const char* caller) -> void {
+    if (mesh_data.n_faces > 0 && mesh_data.faces == nullptr) {
+        throw std::runtime_error(fmt::format(
+            "{} >>> Mesh '{}' has {} faces, but no index buffer", caller,
+            mesh_data.filepath, mesh_data.n_faces));
+    }
+    for (size_t i = 0; i < 3 * mesh_data.n_faces; ++i) {
+        if (mesh_data.faces[i] >= mesh_data.n_vertices) {
+            throw std::runtime_error(fmt::format(
+                "{} >>> Face {} of mesh '{}' uses vertex {}, but the mesh "
+                "only has {} vertices",
+                caller, i / 3, mesh_data.filepath, mesh_data.faces[i],
+                mesh_data.n_vertices));
+        }
+    }
+}
+
+/// Returns the vertices of the given mesh as points
+auto GetPoints(const MeshData& mesh_data) -> std::vector<Point> {
+    std::vector<Point> points(mesh_data.n_vertices);
+    for (size_t i = 0; i < mesh_data.n_vertices; ++i) {
+        points[i] = {static_cast<double>(mesh_data.vertices[3 * i + 0]),
+                     static_cast<double>(mesh_data.vertices[3 * i + 1]),
+                     static_cast<double>(mesh_data.vertices[3 * i + 2])};
+    }
+    return points;
+}
+
+/// Converts a hull of the given points into a mesh (only with used points)
+auto ToMeshData(const std::vector<Point>& points, const HullResult& hull)
+    -> MeshData {
+    MeshData mesh_data;
+    if (hull.degenerate) {
+        mesh_data.n_vertices = points.size();
+        mesh_data.vertices = SharedBuffer<Scalar>(3 * points.size());
+        auto* vertices = mesh_data.vertices.mutable_data();
+        for (size_t i = 0; i < points.size(); ++i) {
+            for (size_t k = 0; k < 3; ++k) {
+                vertices[3 * i + k] = static_cast<Scalar>(points[i][k]);
+            }
+        }
+        return mesh_data;
+    }
+
+    constexpr auto UNUSED = std::numeric_limits<uint32_t>::max();
+    std::vector<uint32_t> remap(points.size(), UNUSED);
+    std::vector<Scalar> vertices;
+    std::vector<uint32_t> faces;
+    faces.reserve(3 * hull.faces.size());
+    for (const auto& face : hull.faces) {
+        for (auto v : face.v) {
+            if (remap[v] == UNUSED) {
+                remap[v] = static_cast<uint32_t>(vertices.size() / 3);
+                for (size_t k = 0; k < 3; ++k) {
+                    vertices.push_back(static_cast<Scalar>(points[v][k]));
+                }
+            }
+            faces.push_back(remap[v]);
+        }
+    }
+    mesh_data.n_vertices = vertices.size() / 3;
+    mesh_data.n_faces = faces.size() / 3;
+    mesh_data.vertices = SharedBuffer<Scalar>(vertices.data(), vertices.size());
+    mesh_data.faces = SharedBuffer<uint32_t>(faces.data(), faces.size());
+    return mesh_data;
+}
+
+/// Piece of a mesh during the decomposition (a subset of its triangles)
+struct MeshPiece {
+    /// Indices of the triangles of the mesh that belong to this piece
+    std::vector<size_t> triangles;
+    /// Max. distance from a triangle of the piece to the hull of the piece
+    double concavity = 0.0;
+    /// Centroid of the triangle of the piece farthest from its hull
+    Point deepest{};
+    /// Whether the piece can't be split any further
+    bool final = false;
+};
+
+/// Returns the points of the vertices used by the given triangles
+auto GetPiecePoints(const std::vector<Point>& points,
+                    const MeshData& mesh_data,
+                    const std::vector<size_t>& triangles)
+    -> std::vector<Point> {
+    std::vector<uint8_t> used(points.size(), 0);
+    std::vector<Point> piece_points;
+    for (auto t : triangles) {
+        for (size_t c = 0; c < 3; ++c) {
+            auto v = mesh_data.faces[3 * t + c];
+            if (v < points.size() && used[v] == 0) {
+                used[v] = 1;
+                piece_points.push_back(points[v]);
+            }
+        }
+    }
+    return piece_points;
+}
+
+/// \brief Computes how far the surface of the given piece is from its hull
+///
+/// A ray is cast from the centroid of each triangle along its normal, and the
+/// distance to where it leaves the hull is measured (zero for triangles on
+/// the hull, large for the walls of cavities). Returns false if the piece is
+/// flat (it has no volume, so it can't be a piece of the decomposition)
+auto EvaluatePiece(const std::vector<Point>& points, const MeshData& mesh_data,
+                   MeshPiece& piece) -> bool {
+    auto piece_points = GetPiecePoints(points, mesh_data, piece.triangles);
+    auto hull = QuickHull(piece_points, 0);
+    piece.concavity = 0.0;
+    if (hull.degenerate) {
+        return false;
+    }
+    for (auto t : piece.triangles) {
+        const auto& a = points[mesh_data.faces[3 * t + 0]];
+        const auto& b = points[mesh_data.faces[3 * t + 1]];
+        const auto& c = points[mesh_data.faces[3 * t + 2]];
+        auto normal = Cross(Sub(b, a), Sub(c, a));
+        auto length = Length(normal);
+        if (length <= 0.0) {
+            continue;
+        }
+        const Point DIR = {normal[0] / length, normal[1] / length,
+                           normal[2] / length};
+        const Point CENTROID = {(a[0] + b[0] + c[0]) / 3.0,
+                                (a[1] + b[1] + c[1]) / 3.0,
+                                (a[2] + b[2] + c[2]) / 3.0};
+        auto distance = std::numeric_limits<double>::max();
+        for (const auto& face : hull.faces) {
+            auto speed = Dot(face.normal, DIR);
+            if (speed > 0.0) {
+                distance = std::min(distance, -face.Distance(CENTROID) / speed);
+            }
+        }
+        if (distance < std::numeric_limits<double>::max() &&
+            distance > piece.concavity) {
+            piece.concavity = distance;
+            piece.deepest = CENTROID;
+        }
+    }
+    return true;
+}
+
+/// Splits the given piece in two, with a plane normal to its longest axis,
+/// through its deepest triangle or its middle (returns false if it can't)
+auto SplitPiece(const std::vector<Point>& points, const MeshData& mesh_data,
+                const MeshPiece& piece, bool at_middle, MeshPiece& lower,
+                MeshPiece& upper) -> bool {
+    std::vector<Point> centroids;
+    std::vector<Point> normals;
+    centroids.reserve(piece.triangles.size());
+    normals.reserve(piece.triangles.size());
+    for (auto t : piece.triangles) {
+        const auto& a = points[mesh_data.faces[3 * t + 0]];
+        const auto& b = points[mesh_data.faces[3 * t + 1]];
+        const auto& c = points[mesh_data.faces[3 * t + 2]];
+        centroids.push_back({(a[0] + b[0] + c[0]) / 3.0,
+                             (a[1] + b[1] + c[1]) / 3.0,
+                             (a[2] + b[2] + c[2]) / 3.0});
+        normals.push_back(Cross(Sub(b, a), Sub(c, a)));
+    }
+    Point lower_bound = centroids[0];
+    Point upper_bound = centroids[0];
+    for (const auto& c : centroids) {
+        for (size_t k = 0; k < 3; ++k) {
+            lower_bound[k] = std::min(lower_bound[k], c[k]);
+            upper_bound[k] = std::max(upper_bound[k], c[k]);
+        }
+    }
+    auto extent = Sub(upper_bound, lower_bound);
+    auto axis = static_cast<size_t>(
+        std::max_element(extent.begin(), extent.end()) - extent.begin());
+    if (extent[axis] <= 0.0) {
+        return false;
+    }
+
+    // Split at the deepest triangle, or in the middle if that's at the border
+    auto split = piece.deepest[axis];
+    if (at_middle || split <= lower_bound[axis] || split >= upper_bound[axis]) {
+        split = 0.5 * (lower_bound[axis] + upper_bound[axis]);
+    }
+    // Triangles lying on the split plane go to the side that's behind them
+    // (e.g. the wall of a cavity stays with the part of the mesh it bounds)
+    const auto EPSILON = RELATIVE_EPSILON * extent[axis];
+    lower.triangles.clear();
+    upper.triangles.clear();
+    for (size_t i = 0; i < piece.triangles.size(); ++i) {
+        auto on_plane = std::abs(centroids[i][axis] - split) <= EPSILON;
+        auto is_lower = on_plane ? (normals[i][axis] > 0.0)
+                                 : (centroids[i][axis] < split);
+        auto& side = is_lower ? lower : upper;
+        side.triangles.push_back(piece.triangles[i]);
+    }
+    return !lower.triangles.empty() && !upper.triangles.empty();
+}
+}  // namespace
+
+auto ConvexDecomposition::ComputeHull(const MeshData& mesh_data,
+                                      size_t max_vertices) -> MeshData {
+    LOCO_PROFILE_SCOPE("ConvexDecomposition::ComputeHull");
+    if (max_vertices > 0) {
+        max_vertices = std::max<size_t>(max_vertices, 4);
+    }
+    auto points = GetPoints(mesh_data);
+    auto hull = QuickHullCorners(points, max_vertices);
+    return ToMeshData(points, hull);
+}
+
+auto ConvexDecomposition::Decompose(const MeshData& mesh_data,
+                                    const ConvexDecompositionParams& params)
+    -> std::vector<MeshData> {
+    LOCO_PROFILE_SCOPE("ConvexDecomposition::Decompose");
+    ValidateFaces(mesh_data, "ConvexDecomposition::Decompose");
+    auto points = GetPoints(mesh_data);
+    if (mesh_data.n_faces == 0 || params.max_hulls <= 1) {
+        auto hull = QuickHullCorners(points, params.max_vertices_per_hull);
+        return {ToMeshData(points, hull)};
+    }
+
+    // Keep splitting the most concave piece, until all pieces are convex
+    // enough, or until we run out of pieces
+    const auto MAX_CONCAVITY = static_cast<double>(params.max_concavity) *
+                               BoundingDiagonal(points);
+    std::vector<MeshPiece> pieces(1);
+    pieces[0].triangles.resize(mesh_data.n_faces);
+    for (size_t t = 0; t < mesh_data.n_faces; ++t) {
+        pieces[0].triangles[t] = t;
+    }
+    EvaluatePiece(points, mesh_data, pieces[0]);
+    while (pieces.size() < params.max_hulls) {
+        auto it = std::max_element(
+            pieces.begin(), pieces.end(),
+            [](const MeshPiece& a, const MeshPiece& b) {
+                return (a.final ? 0.0 : a.concavity) <
+                       (b.final ? 0.0 : b.concavity);
+            });
+        if (it->final || it->concavity <= MAX_CONCAVITY) {
+            break;
+        }
+        // Flat pieces (e.g. a single wall) are no good, so in that case try
+        // splitting in the middle instead, before giving up on this piece
+        MeshPiece lower;
+        MeshPiece upper;
+        bool is_split = false;
+        for (auto at_middle : {false, true}) {
+            if (SplitPiece(points, mesh_data, *it, at_middle, lower, upper) &&
+                EvaluatePiece(points, mesh_data, lower) &&
+                EvaluatePiece(points, mesh_data, upper)) {
+                is_split = true;
+                break;
+            }
+        }
+        if (!is_split) {
+            it->final = true;
+            continue;
+        }
+        *it = std::move(lower);
+        pieces.push_back(std::move(upper));
+    }
+
+    std::vector<MeshData> hulls;
+    hulls.reserve(pieces.size());
+    for (const auto& piece : pieces) {
+        auto piece_points = GetPiecePoints(points, mesh_data, piece.triangles);
+        auto hull =
+            QuickHullCorners(piece_points, params.max_vertices_per_hull);
+        hulls.push_back(ToMeshData(piece_points, hull));
+    }
+    return hulls;
+}
+
+auto ConvexDecomposition::MakeConvexCollider(
+    const ColliderData& data, const ConvexDecompositionParams& params)
+    -> ColliderData {
+    if (data.type != eShapeType::CONVEX_MESH &&
+        data.type != eShapeType::TRIANGULAR_MESH) {
+        throw std::runtime_error(fmt::format(
+            "ConvexDecomposition::MakeConvexCollider >>> Expected a mesh "
+            "collider, but got a collider of type '{}'",
+            ToString(data.type)));
+    }
+    ValidateFaces(data.mesh_data, "ConvexDecomposition::MakeConvexCollider");
+    auto hulls = Decompose(data.mesh_data, params);
+
+    ColliderData result = data;
+    result.mesh_data = MeshData();
+    result.children.clear();
+    if (hulls.size() == 1) {
+        result.type = eShapeType::CONVEX_MESH;
+        result.mesh_data = std::move(hulls[0]);
+        return result;
+    }
+    result.type = eShapeType::COMPOUND;
+    for (auto& hull : hulls) {
+        ColliderData child;
+        child.type = eShapeType::CONVEX_MESH;
+        child.size = data.size;
+        child.mesh_data = std::move(hull);
+        child.collision_group = data.collision_group;
+        child.collision_mask = data.collision_mask;
+        child.friction = data.friction;
+        result.children.push_back(std::move(child));
+    }
+    return result;
+}
+
+}  // namespace core
+}  // namespace loco
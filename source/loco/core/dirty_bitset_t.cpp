@@ -0,0 +1,54 @@
+#include <loco/core/dirty_bitset_t.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace loco {
+namespace core {
+
+auto DirtyBitset::Resize(size_t num_bits) -> void {
+    if (num_bits <= m_NumBits) {
+        return;
+    }
+    const auto NUM_WORDS = _NumWords(num_bits);
+    if (NUM_WORDS > m_Capacity) {
+        // Grow geometrically, as drawables are usually added one at a time
+        const auto NEW_CAPACITY = std::max(NUM_WORDS, 2 * m_Capacity);
+        // NOLINTNEXTLINE
+        std::unique_ptr<std::atomic<uint64_t>[]> words(
+            new std::atomic<uint64_t>[NEW_CAPACITY]);
+        for (size_t w = 0; w < NEW_CAPACITY; ++w) {
+            words[w].store(
+                (w < m_Capacity) ? m_Words[w].load(std::memory_order_relaxed)
+                                 : 0,
+                std::memory_order_relaxed);
+        }
+        m_Words = std::move(words);
+        m_Capacity = NEW_CAPACITY;
+    }
+    m_NumBits = num_bits;
+}
+
+auto DirtyBitset::Test(size_t index) const -> bool {
+    if (index >= m_NumBits) {
+        return false;
+    }
+    const auto WORD = m_Words[index / BITS_PER_WORD].load(
+        std::memory_order_relaxed);
+    return ((WORD >> (index % BITS_PER_WORD)) & 1U) != 0;
+}
+
+auto DirtyBitset::count() const -> size_t {
+    size_t num_marked = 0;
+    const auto NUM_WORDS = _NumWords(m_NumBits);
+    for (size_t w = 0; w < NUM_WORDS; ++w) {
+        auto word = m_Words[w].load(std::memory_order_relaxed);
+        for (; word != 0; word &= word - 1) {
+            num_marked++;
+        }
+    }
+    return num_marked;
+}
+
+}  // namespace core
+}  // namespace loco
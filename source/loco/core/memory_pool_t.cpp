@@ -0,0 +1,129 @@
+#include <loco/core/memory_pool_t.hpp>
+
+#include <algorithm>
+#include <array>
+#include <new>
+
+namespace loco {
+namespace core {
+
+namespace {
+/// Number of size classes (powers of two from MIN to MAX pooled sizes)
+constexpr size_t NUM_SIZE_CLASSES = 7;
+
+static_assert(SmallObjectAllocator::MIN_POOLED_SIZE
+                      << (NUM_SIZE_CLASSES - 1) >=
+                  SmallObjectAllocator::MAX_POOLED_SIZE,
+              "Not enough size classes to cover all pooled sizes");
+
+/// Returns the index of the size class that serves objects of the given size
+auto GetSizeClass(size_t size) -> size_t {
+    size_t size_class = 0;
+    size_t class_size = SmallObjectAllocator::MIN_POOLED_SIZE;
+    while (class_size < size) {
+        class_size <<= 1U;
+        size_class++;
+    }
+    return size_class;
+}
+
+/// Returns the pool that serves objects of the given size class
+auto GetPool(size_t size_class) -> MemoryPool& {
+    using PoolArray = std::array<MemoryPool::uptr, NUM_SIZE_CLASSES>;
+    // Intentionally leaked, as pooled objects might be released by the
+    // destructors of other static objects, after this one would be destroyed
+    static auto* s_Pools = []() {
+        auto* pools = new PoolArray();
+        for (size_t i = 0; i < NUM_SIZE_CLASSES; ++i) {
+            (*pools)[i] = std::make_unique<MemoryPool>(
+                SmallObjectAllocator::MIN_POOLED_SIZE << i);
+        }
+        return pools;
+    }();
+    return *(*s_Pools)[size_class];
+}
+}  // namespace
+
+MemoryPool::MemoryPool(size_t block_size, size_t blocks_per_chunk)
+    : m_BlocksPerChunk(std::max<size_t>(1, blocks_per_chunk)) {
+    // Blocks must hold the free-list header, and keep the max. alignment
+    constexpr size_t ALIGNMENT = alignof(std::max_align_t);
+    block_size = std::max(block_size, sizeof(FreeBlock));
+    m_BlockSize = (block_size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+auto MemoryPool::Allocate() -> void* {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (m_FreeList == nullptr) {
+        _Grow();
+    }
+    auto* block = m_FreeList;
+    m_FreeList = block->next;
+    m_NumAllocated++;
+    return block;
+}
+
+auto MemoryPool::Deallocate(void* ptr) -> void {
+    if (ptr == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto* block = static_cast<FreeBlock*>(ptr);
+    block->next = m_FreeList;
+    m_FreeList = block;
+    m_NumAllocated--;
+}
+
+auto MemoryPool::num_chunks() const -> size_t {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Chunks.size();
+}
+
+auto MemoryPool::num_allocated() const -> size_t {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_NumAllocated;
+}
+
+auto MemoryPool::_Grow() -> void {
+    // NOLINTNEXTLINE
+    m_Chunks.emplace_back(new uint8_t[m_BlockSize * m_BlocksPerChunk]);
+    auto* chunk = m_Chunks.back().get();
+    // Link the blocks in address order, so consecutive allocations are too
+    for (size_t i = m_BlocksPerChunk; i > 0; --i) {
+        auto* block = new (chunk + (i - 1) * m_BlockSize) FreeBlock();
+        block->next = m_FreeList;
+        m_FreeList = block;
+    }
+}
+
+auto SmallObjectAllocator::Allocate(size_t size) -> void* {
+    if (size > MAX_POOLED_SIZE) {
+        return ::operator new(size);
+    }
+    return GetPool(GetSizeClass(size)).Allocate();
+}
+
+auto SmallObjectAllocator::Deallocate(void* ptr, size_t size) -> void {
+    if (size > MAX_POOLED_SIZE) {
+        ::operator delete(ptr);
+        return;
+    }
+    GetPool(GetSizeClass(size)).Deallocate(ptr);
+}
+
+auto SmallObjectAllocator::num_allocated(size_t size) -> size_t {
+    if (size > MAX_POOLED_SIZE) {
+        return 0;
+    }
+    return GetPool(GetSizeClass(size)).num_allocated();
+}
+
+auto SmallObjectAllocator::num_chunks(size_t size) -> size_t {
+    if (size > MAX_POOLED_SIZE) {
+        return 0;
+    }
+    return GetPool(GetSizeClass(size)).num_chunks();
+}
+
+}  // namespace core
+}  // namespace loco
@@ -0,0 +1,584 @@
+#include <loco/core/mesh_loader_t.hpp>
+
+#include <spdlog/fmt/bundled/format.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <sys/stat.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define LOCO_MESH_CACHE_MMAP_ENABLED
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <direct.h>
+#include <process.h>
+#endif
+
+namespace loco {
+namespace core {
+
+namespace {
+/// Header at the start of every cache file (followed by vertices and faces)
+struct MeshCacheHeader {
+    /// Identifies the file as a mesh cache (always CACHE_MAGIC)
+    char magic[8];  // NOLINT
+    /// Version of the format used to write the file
+    uint32_t version;
+    /// Size in bytes of each scalar in the vertex buffer
+    uint32_t scalar_size;
+    /// Number of vertices in the vertex buffer (3 scalars each)
+    uint64_t n_vertices;
+    /// Number of faces in the index buffer (3 indices each)
+    uint64_t n_faces;
+    /// Size in bytes of the mesh file the cache was built from
+    uint64_t source_size;
+    /// Modification time of the mesh file the cache was built from
+    int64_t source_mtime;
+    /// Reserved for future use (keeps the buffers 16-byte aligned)
+    uint64_t reserved[2];  // NOLINT
+};
+
+static_assert(sizeof(MeshCacheHeader) == 64,
+              "MeshCacheHeader must keep a fixed size of 64 bytes");
+
+/// Magic string written at the start of every cache file
+constexpr const char* CACHE_MAGIC = "LOCOMESH";
+
+/// Mutex used to protect the settings of the loader
+std::mutex g_SettingsMutex;
+/// Directory where caches are written (empty means the default one)
+std::string g_CacheDirectory;
+/// Whether or not Load() uses cache files
+bool g_CacheEnabled = true;
+
+/// Size and modification time of a file (used to detect stale caches)
+struct FileStamp {
+    /// Size of the file in bytes
+    uint64_t size = 0;
+    /// Modification time of the file (seconds since epoch)
+    int64_t mtime = 0;
+};
+
+/// Returns the stamp of the given file (false if it doesn't exist)
+auto GetFileStamp(const std::string& filepath, FileStamp& stamp) -> bool {
+    struct stat file_stat {};
+    if (stat(filepath.c_str(), &file_stat) != 0) {
+        return false;
+    }
+    stamp.size = static_cast<uint64_t>(file_stat.st_size);
+    stamp.mtime = static_cast<int64_t>(file_stat.st_mtime);
+    return true;
+}
+
+/// Returns the id of the current process (used to name temporary files, so
+/// processes sharing a cache directory never write into the same file)
+auto GetProcessId() -> int64_t {
+#if defined(LOCO_MESH_CACHE_MMAP_ENABLED)
+    return static_cast<int64_t>(getpid());
+#elif defined(_WIN32)
+    return static_cast<int64_t>(_getpid());
+#else
+    return 0;
+#endif
+}
+
+/// Returns the value of the given environment variable (empty if not set)
+auto GetEnv(const char* name) -> std::string {
+    const char* value = std::getenv(name);  // NOLINT
+    return (value == nullptr) ? std::string() : std::string(value);
+}
+
+/// Returns the default directory for the caches, in the cache directory of
+/// the user (empty if it can't be found)
+auto GetDefaultCacheDirectory() -> std::string {
+#if defined(_WIN32)
+    const auto LOCAL_APP_DATA = GetEnv("LOCALAPPDATA");
+    if (!LOCAL_APP_DATA.empty()) {
+        return LOCAL_APP_DATA + "/loco/meshes";
+    }
+#else
+    const auto XDG_CACHE_HOME = GetEnv("XDG_CACHE_HOME");
+    if (!XDG_CACHE_HOME.empty()) {
+        return XDG_CACHE_HOME + "/loco/meshes";
+    }
+    const auto HOME = GetEnv("HOME");
+    if (!HOME.empty()) {
+        return HOME + "/.cache/loco/meshes";
+    }
+#endif
+    return "";
+}
+
+/// Returns the absolute path of the given file (resolving links if it exists)
+auto GetAbsolutePath(const std::string& filepath) -> std::string {
+#if defined(LOCO_MESH_CACHE_MMAP_ENABLED)
+    std::unique_ptr<char, decltype(&std::free)> resolved(
+        realpath(filepath.c_str(), nullptr), &std::free);
+    if (resolved != nullptr) {
+        return resolved.get();
+    }
+    if (!filepath.empty() && filepath[0] == '/') {
+        return filepath;
+    }
+    std::unique_ptr<char, decltype(&std::free)> cwd(getcwd(nullptr, 0),
+                                                    &std::free);
+    return (cwd == nullptr) ? filepath
+                            : std::string(cwd.get()) + "/" + filepath;
+#elif defined(_WIN32)
+    std::unique_ptr<char, decltype(&std::free)> resolved(
+        _fullpath(nullptr, filepath.c_str(), 0), &std::free);
+    return (resolved == nullptr) ? filepath : std::string(resolved.get());
+#else
+    return filepath;
+#endif
+}
+
+/// Creates the given directory and its missing parents (false on failure)
+auto CreateDirectories(const std::string& dirpath) -> bool {
+    struct stat dir_stat {};
+    if (dirpath.empty() || stat(dirpath.c_str(), &dir_stat) == 0) {
+        return !dirpath.empty() && (dir_stat.st_mode & S_IFDIR) != 0;
+    }
+    auto pos = dirpath.find_last_of("/\\");
+    if (pos != std::string::npos && pos > 0 &&
+        !CreateDirectories(dirpath.substr(0, pos))) {
+        return false;
+    }
+#if defined(_WIN32)
+    const auto RESULT = _mkdir(dirpath.c_str());
+#else
+    const auto RESULT = mkdir(dirpath.c_str(), 0755);  // NOLINT
+#endif
+    // Another process might have created it in the meantime
+    return RESULT == 0 || stat(dirpath.c_str(), &dir_stat) == 0;
+}
+
+/// Returns the 64-bit FNV-1a hash of the given string (stable across runs and
+/// platforms, unlike std::hash, so all processes agree on the cache names)
+auto HashPath(const std::string& path) -> uint64_t {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (auto c : path) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/// Returns the extension of the given file in lowercase (e.g. ".obj")
+auto GetExtension(const std::string& filepath) -> std::string {
+    auto pos = filepath.find_last_of('.');
+    if (pos == std::string::npos) {
+        return "";
+    }
+    auto extension = filepath.substr(pos);
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    return extension;
+}
+
+/// Reads the whole contents of the given file
+auto ReadFile(const std::string& filepath) -> std::string {
+    std::ifstream file(filepath, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error(fmt::format(
+            "MeshLoader::Parse >>> Couldn't open file '{}'", filepath));
+    }
+    return {std::istreambuf_iterator<char>(file),
+            std::istreambuf_iterator<char>()};
+}
+
+/// Moves the given vertex and index lists into the buffers of a MeshData
+auto MakeMeshData(const std::string& filepath,
+                  const std::vector<Scalar>& vertices,
+                  const std::vector<uint32_t>& faces) -> MeshData {
+    MeshData mesh_data;
+    mesh_data.filepath = filepath;
+    mesh_data.n_vertices = vertices.size() / 3;
+    mesh_data.n_faces = faces.size() / 3;
+    mesh_data.vertices = SharedBuffer<Scalar>(vertices.data(), vertices.size());
+    mesh_data.faces = SharedBuffer<uint32_t>(faces.data(), faces.size());
+    return mesh_data;
+}
+
+/// Parses the vertices and faces of a Wavefront OBJ file (polygons are
+/// triangulated as fans, and texture coordinates and normals are ignored)
+auto ParseObj(const std::string& filepath) -> MeshData {
+    const auto CONTENTS = ReadFile(filepath);
+    std::vector<Scalar> vertices;
+    std::vector<uint32_t> faces;
+    std::vector<uint32_t> polygon;
+
+    const char* cursor = CONTENTS.c_str();
+    const char* end = cursor + CONTENTS.size();
+    while (cursor < end) {
+        const char* line_end = std::find(cursor, end, '\n');
+        if (line_end - cursor > 2 && cursor[0] == 'v' && cursor[1] == ' ') {
+            char* next = nullptr;
+            const char* ptr = cursor + 2;
+            for (size_t i = 0; i < 3; ++i) {
+                auto value = std::strtod(ptr, &next);
+                vertices.push_back(static_cast<Scalar>(value));
+                ptr = next;
+            }
+        } else if (line_end - cursor > 2 && cursor[0] == 'f' &&
+                   cursor[1] == ' ') {
+            // Each corner is "v", "v/vt", "v//vn" or "v/vt/vn" (1-based, or
+            // negative to index from the end of the current vertex list)
+            polygon.clear();
+            const char* ptr = cursor + 2;
+            while (ptr < line_end) {
+                char* next = nullptr;
+                auto index = std::strtol(ptr, &next, 10);
+                if (next == ptr) {
+                    break;
+                }
+                const auto NUM_VERTICES =
+                    static_cast<long>(vertices.size() / 3);
+                const auto VERTEX_ID =
+                    (index < 0) ? NUM_VERTICES + index : index - 1;
+                if (index == 0 || VERTEX_ID < 0 ||
+                    VERTEX_ID >= NUM_VERTICES) {
+                    throw std::runtime_error(fmt::format(
+                        "MeshLoader::Parse >>> Invalid face index {} in file "
+                        "{} (expected a vertex in [1, {}], or a negative "
+                        "index from the end of that range)",
+                        index, filepath, NUM_VERTICES));
+                }
+                polygon.push_back(static_cast<uint32_t>(VERTEX_ID));
+                ptr = next;
+                while (ptr < line_end && !std::isspace(*ptr)) {
+                    ptr++;
+                }
+            }
+            for (size_t i = 1; i + 1 < polygon.size(); ++i) {
+                faces.push_back(polygon[0]);
+                faces.push_back(polygon[i]);
+                faces.push_back(polygon[i + 1]);
+            }
+        }
+        cursor = line_end + 1;
+    }
+    return MakeMeshData(filepath, vertices, faces);
+}
+
+/// Key used to merge the repeated vertices of STL files
+struct VertexKey {
+    /// The coordinates of the vertex
+    Scalar x, y, z;  // NOLINT
+
+    auto operator==(const VertexKey& other) const -> bool {
+        return x == other.x && y == other.y && z == other.z;
+    }
+};
+
+/// Hash used to merge the repeated vertices of STL files
+struct VertexKeyHash {
+    auto operator()(const VertexKey& key) const -> size_t {
+        std::hash<Scalar> hasher;
+        auto seed = hasher(key.x);
+        seed ^= hasher(key.y) + 0x9e3779b9 + (seed << 6U) + (seed >> 2U);
+        seed ^= hasher(key.z) + 0x9e3779b9 + (seed << 6U) + (seed >> 2U);
+        return seed;
+    }
+};
+
+/// Parses the triangles of a binary or ASCII STL file (STL stores the three
+/// corners of every triangle, so repeated vertices are merged)
+auto ParseStl(const std::string& filepath) -> MeshData {
+    const auto CONTENTS = ReadFile(filepath);
+    std::vector<Scalar> vertices;
+    std::vector<uint32_t> faces;
+    std::unordered_map<VertexKey, uint32_t, VertexKeyHash> vertex_ids;
+
+    auto add_vertex = [&](const VertexKey& key) {
+        auto it = vertex_ids.find(key);
+        if (it == vertex_ids.end()) {
+            auto id = static_cast<uint32_t>(vertices.size() / 3);
+            it = vertex_ids.emplace(key, id).first;
+            vertices.insert(vertices.end(), {key.x, key.y, key.z});
+        }
+        faces.push_back(it->second);
+    };
+
+    // Binary STL: 80-byte header, triangle count, and 50 bytes per triangle
+    constexpr size_t HEADER_SIZE = 84;
+    constexpr size_t TRIANGLE_SIZE = 50;
+    uint32_t n_triangles = 0;
+    if (CONTENTS.size() >= HEADER_SIZE) {
+        memcpy(&n_triangles, CONTENTS.data() + 80, sizeof(uint32_t));
+    }
+    if (CONTENTS.size() >= HEADER_SIZE &&
+        CONTENTS.size() == HEADER_SIZE + TRIANGLE_SIZE * n_triangles) {
+        vertex_ids.reserve(n_triangles);
+        faces.reserve(3 * static_cast<size_t>(n_triangles));
+        for (size_t t = 0; t < n_triangles; ++t) {
+            // Skip the normal (3 floats), then read the 3 corners
+            const char* corners = CONTENTS.data() + HEADER_SIZE +
+                                  t * TRIANGLE_SIZE + 3 * sizeof(float);
+            for (size_t c = 0; c < 3; ++c) {
+                float xyz[3];  // NOLINT
+                memcpy(xyz, corners + c * sizeof(xyz), sizeof(xyz));
+                add_vertex({static_cast<Scalar>(xyz[0]),
+                            static_cast<Scalar>(xyz[1]),
+                            static_cast<Scalar>(xyz[2])});
+            }
+        }
+        return MakeMeshData(filepath, vertices, faces);
+    }
+
+    // ASCII STL: every "vertex x y z" line is a corner of the current facet
+    const char* ptr = CONTENTS.c_str();
+    while ((ptr = std::strstr(ptr, "vertex")) != nullptr) {
+        ptr += std::strlen("vertex");
+        char* next = nullptr;
+        VertexKey key{};
+        key.x = static_cast<Scalar>(std::strtod(ptr, &next));
+        key.y = static_cast<Scalar>(std::strtod(next, &next));
+        key.z = static_cast<Scalar>(std::strtod(next, &next));
+        add_vertex(key);
+        ptr = next;
+    }
+    faces.resize(faces.size() - faces.size() % 3);
+    return MakeMeshData(filepath, vertices, faces);
+}
+
+/// Writes the given mesh into a cache file (atomically, through a rename)
+auto WriteCache(const std::string& cache_path, const MeshData& mesh_data,
+                const FileStamp& stamp) -> bool {
+    MeshCacheHeader header{};
+    memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+    header.version = MeshLoader::CACHE_VERSION;
+    header.scalar_size = sizeof(Scalar);
+    header.n_vertices = mesh_data.n_vertices;
+    header.n_faces = mesh_data.n_faces;
+    header.source_size = stamp.size;
+    header.source_mtime = stamp.mtime;
+
+    // Write into a temporary file first, so concurrent loaders never see a
+    // partially written cache
+    const auto TMP_PATH = fmt::format(
+        "{}.{}.{}.tmp", cache_path, GetProcessId(),
+        std::hash<std::thread::id>()(std::this_thread::get_id()));
+    {
+        std::ofstream file(TMP_PATH, std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(mesh_data.vertices.get()),
+                   static_cast<std::streamsize>(sizeof(Scalar) * 3 *
+                                                mesh_data.n_vertices));
+        file.write(reinterpret_cast<const char*>(mesh_data.faces.get()),
+                   static_cast<std::streamsize>(sizeof(uint32_t) * 3 *
+                                                mesh_data.n_faces));
+        if (!file.good()) {
+            std::remove(TMP_PATH.c_str());
+            return false;
+        }
+    }
+    if (std::rename(TMP_PATH.c_str(), cache_path.c_str()) != 0) {
+        std::remove(TMP_PATH.c_str());
+        return false;
+    }
+    return true;
+}
+
+/// Returns whether the given header describes a valid cache of a mesh file
+auto IsValidCache(const MeshCacheHeader& header, const FileStamp& stamp,
+                  uint64_t cache_size) -> bool {
+    const auto EXPECTED_SIZE = sizeof(MeshCacheHeader) +
+                               sizeof(Scalar) * 3 * header.n_vertices +
+                               sizeof(uint32_t) * 3 * header.n_faces;
+    return memcmp(header.magic, CACHE_MAGIC, sizeof(header.magic)) == 0 &&
+           header.version == MeshLoader::CACHE_VERSION &&
+           header.scalar_size == sizeof(Scalar) &&
+           header.source_size == stamp.size &&
+           header.source_mtime == stamp.mtime && cache_size == EXPECTED_SIZE;
+}
+
+#if defined(LOCO_MESH_CACHE_MMAP_ENABLED)
+/// Read-only view of a file mapped into memory (unmapped when destroyed)
+struct MappedFile {
+    MappedFile(void* p_data, size_t p_size) : data(p_data), size(p_size) {}
+
+    ~MappedFile() { munmap(data, size); }
+
+    MappedFile(const MappedFile&) = delete;
+    auto operator=(const MappedFile&) -> MappedFile& = delete;
+
+    /// Start of the mapped pages
+    void* data = nullptr;
+    /// Size of the mapping in bytes
+    size_t size = 0;
+};
+
+/// Maps the given cache file, and returns buffers pointing into the mapping
+auto ReadCache(const std::string& cache_path, const FileStamp& stamp,
+               MeshData& mesh_data) -> bool {
+    auto fd = open(cache_path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat cache_stat {};
+    if (fstat(fd, &cache_stat) != 0 ||
+        static_cast<size_t>(cache_stat.st_size) < sizeof(MeshCacheHeader)) {
+        close(fd);
+        return false;
+    }
+    const auto CACHE_SIZE = static_cast<size_t>(cache_stat.st_size);
+    // Private mapping: writes (if any) go to copied pages, never to the file
+    auto* data = mmap(nullptr, CACHE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                      fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {  // NOLINT
+        return false;
+    }
+    auto mapping = std::make_shared<MappedFile>(data, CACHE_SIZE);
+
+    MeshCacheHeader header{};
+    memcpy(&header, data, sizeof(header));
+    if (!IsValidCache(header, stamp, CACHE_SIZE)) {
+        return false;
+    }
+
+    auto* vertices = reinterpret_cast<Scalar*>(static_cast<char*>(data) +
+                                               sizeof(MeshCacheHeader));
+    auto* faces = reinterpret_cast<uint32_t*>(vertices + 3 * header.n_vertices);
+    mesh_data.n_vertices = header.n_vertices;
+    mesh_data.n_faces = header.n_faces;
+    mesh_data.vertices = SharedBuffer<Scalar>(
+        std::shared_ptr<Scalar>(mapping, vertices), 3 * header.n_vertices);
+    mesh_data.faces = SharedBuffer<uint32_t>(
+        std::shared_ptr<uint32_t>(mapping, faces), 3 * header.n_faces);
+    return true;
+}
+#else
+/// Reads the given cache file into newly allocated buffers
+auto ReadCache(const std::string& cache_path, const FileStamp& stamp,
+               MeshData& mesh_data) -> bool {
+    std::ifstream file(cache_path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false;
+    }
+    const auto CACHE_SIZE = static_cast<uint64_t>(file.tellg());
+    file.seekg(0);
+    MeshCacheHeader header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        !IsValidCache(header, stamp, CACHE_SIZE)) {
+        return false;
+    }
+    SharedBuffer<Scalar> vertices(3 * header.n_vertices);
+    SharedBuffer<uint32_t> faces(3 * header.n_faces);
+    file.read(reinterpret_cast<char*>(vertices.mutable_data()),
+              static_cast<std::streamsize>(sizeof(Scalar) * vertices.size()));
+    file.read(reinterpret_cast<char*>(faces.mutable_data()),
+              static_cast<std::streamsize>(sizeof(uint32_t) * faces.size()));
+    if (!file.good()) {
+        return false;
+    }
+    mesh_data.n_vertices = header.n_vertices;
+    mesh_data.n_faces = header.n_faces;
+    mesh_data.vertices = std::move(vertices);
+    mesh_data.faces = std::move(faces);
+    return true;
+}
+#endif  // LOCO_MESH_CACHE_MMAP_ENABLED
+}  // namespace
+
+auto MeshLoader::Load(const std::string& filepath) -> MeshData {
+    LOCO_PROFILE_SCOPE("MeshLoader::Load");
+    bool cache_enabled = true;
+    {
+        std::lock_guard<std::mutex> lock(g_SettingsMutex);
+        cache_enabled = g_CacheEnabled;
+    }
+    FileStamp stamp;
+    if (!cache_enabled || !GetFileStamp(filepath, stamp)) {
+        return Parse(filepath);
+    }
+
+    const auto CACHE_PATH = GetCachePath(filepath);
+    MeshData mesh_data;
+    if (ReadCache(CACHE_PATH, stamp, mesh_data)) {
+        mesh_data.filepath = filepath;
+        return mesh_data;
+    }
+
+    mesh_data = Parse(filepath);
+    const auto SEPARATOR = CACHE_PATH.find_last_of("/\\");
+    if ((SEPARATOR != std::string::npos &&
+         !CreateDirectories(CACHE_PATH.substr(0, SEPARATOR))) ||
+        !WriteCache(CACHE_PATH, mesh_data, stamp)) {
+        LOCO_CORE_WARN(
+            "MeshLoader::Load >>> Couldn't write the cache file '{}' (the mesh "
+            "will be parsed again on the next load)",
+            CACHE_PATH);
+    }
+    return mesh_data;
+}
+
+auto MeshLoader::Parse(const std::string& filepath) -> MeshData {
+    LOCO_PROFILE_SCOPE("MeshLoader::Parse");
+    const auto EXTENSION = GetExtension(filepath);
+    if (EXTENSION == ".obj") {
+        return ParseObj(filepath);
+    }
+    if (EXTENSION == ".stl") {
+        return ParseStl(filepath);
+    }
+    throw std::runtime_error(fmt::format(
+        "MeshLoader::Parse >>> Unsupported mesh format '{}' of file '{}'",
+        EXTENSION, filepath));
+}
+
+auto MeshLoader::SetCacheDirectory(const std::string& dirpath) -> void {
+    std::lock_guard<std::mutex> lock(g_SettingsMutex);
+    g_CacheDirectory = dirpath;
+}
+
+auto MeshLoader::SetCacheEnabled(bool enabled) -> void {
+    std::lock_guard<std::mutex> lock(g_SettingsMutex);
+    g_CacheEnabled = enabled;
+}
+
+auto MeshLoader::GetCacheDirectory() -> std::string {
+    {
+        std::lock_guard<std::mutex> lock(g_SettingsMutex);
+        if (!g_CacheDirectory.empty()) {
+            return g_CacheDirectory;
+        }
+    }
+    return GetDefaultCacheDirectory();
+}
+
+auto MeshLoader::GetCachePath(const std::string& filepath) -> std::string {
+    const auto CACHE_DIRECTORY = GetCacheDirectory();
+    if (CACHE_DIRECTORY.empty()) {
+        return filepath + CACHE_EXTENSION;
+    }
+    // Meshes with the same name in different directories (e.g. the links of
+    // different robots) get different caches, keyed by their absolute path
+    const auto ABSOLUTE_PATH = GetAbsolutePath(filepath);
+    auto pos = ABSOLUTE_PATH.find_last_of("/\\");
+    auto filename = (pos == std::string::npos) ? ABSOLUTE_PATH
+                                               : ABSOLUTE_PATH.substr(pos + 1);
+    return fmt::format("{}/{}.{:016x}{}", CACHE_DIRECTORY, filename,
+                       HashPath(ABSOLUTE_PATH), CACHE_EXTENSION);
+}
+
+}  // namespace core
+}  // namespace loco
@@ -5,39 +5,133 @@
 namespace loco {
 namespace core {
 
-Scenario::Scenario() { m_Drawables.reserve(Scenario::MAX_DRAWABLES); }
+Scenario::Scenario(size_t max_single_bodies)
+    : m_DirtyDrawables(std::make_shared<DirtyBitset>()),
+      m_BodyStates(std::make_shared<BodyStateStore>(max_single_bodies)) {
+    m_SingleBodies.Reserve(max_single_bodies);
+    m_Colliders.Reserve(Scenario::RESERVED_COLLIDERS);
+}
 
-Scenario::~Scenario() { m_Drawables.clear(); }
+Scenario::~Scenario() {
+    // Drawables that outlive the scenario go back to syncing eagerly
+    const auto NUM_SLOTS = m_Drawables.num_slots();
+    for (size_t i = 0; i < NUM_SLOTS; ++i) {
+        if (auto* drawable = m_Drawables.Get(m_Drawables.HandleAt(i))) {
+            drawable->SetDirtyTracking(nullptr, 0);
+        }
+    }
+}
 
-auto Scenario::AddDrawable(Drawable::ptr drawable) -> void {
-    auto drawable_name = drawable->name();
-    m_Drawables.push_back(std::move(drawable));
-    m_DrawablesKeymap[drawable_name] = m_Drawables.size() - 1;
+auto Scenario::AddDrawable(Drawable::ptr drawable) -> DrawableHandle {
+    const auto& drawable_name = drawable->name();
+    auto handle = m_Drawables.Insert(drawable);
+    m_DrawablesKeymap[drawable_name] = handle;
+    m_DirtyDrawables->Resize(m_Drawables.num_slots());
+    drawable->SetDirtyTracking(m_DirtyDrawables, handle.index);
+    return handle;
 }
 
-auto Scenario::GetDrawableByIndex(size_t index) -> Drawable::ptr {
-    if (index < 0 || index > m_Drawables.size() - 1) {
+auto Scenario::RemoveDrawable(DrawableHandle handle) -> Drawable::ptr {
+    auto drawable = m_Drawables.Remove(handle);
+    if (drawable == nullptr) {
         return nullptr;
     }
-    return m_Drawables[index];
+    drawable->SetDirtyTracking(nullptr, 0);
+    // Only unlink the name if it wasn't taken over by a later drawable
+    auto it = m_DrawablesKeymap.find(drawable->name());
+    if (it != m_DrawablesKeymap.end() && it->second == handle) {
+        m_DrawablesKeymap.erase(it);
+    }
+    return drawable;
 }
 
-auto Scenario::GetDrawableByName(const std::string& name) -> Drawable::ptr {
-    if (m_DrawablesKeymap.find(name) == m_DrawablesKeymap.end()) {
-        return nullptr;
+auto Scenario::GetDrawable(DrawableHandle handle) const -> Drawable* {
+    return m_Drawables.Get(handle);
+}
+
+auto Scenario::FindDrawable(const std::string& name) const -> DrawableHandle {
+    auto it = m_DrawablesKeymap.find(name);
+    if (it == m_DrawablesKeymap.end()) {
+        return {};
     }
-    return m_Drawables[m_DrawablesKeymap[name]];
+    return it->second;
+}
+
+auto Scenario::GetDrawableByIndex(size_t index) -> Drawable::ptr {
+    return m_Drawables.GetShared(m_Drawables.HandleAt(index));
+}
+
+auto Scenario::GetDrawableByName(const std::string& name) -> Drawable::ptr {
+    return m_Drawables.GetShared(FindDrawable(name));
 }
 
 auto Scenario::num_drawables() const -> size_t { return m_Drawables.size(); }
 
+auto Scenario::num_drawable_slots() const -> size_t {
+    return m_Drawables.num_slots();
+}
+
+auto Scenario::SyncDrawables() -> void {
+    LOCO_PROFILE_SCOPE("Scenario::SyncDrawables");
+    m_DirtyDrawables->Consume([this](size_t index) {
+        // The slot might have been freed (or reused) since it was marked
+        if (auto* drawable = m_Drawables.Get(m_Drawables.HandleAt(index))) {
+            drawable->SyncAdapter();
+        }
+    });
+}
+
+auto Scenario::num_dirty_drawables() const -> size_t {
+    return m_DirtyDrawables->count();
+}
+
+auto Scenario::AddSingleBody(SingleBody::ptr body) -> SingleBodyHandle {
+    body->SetStateStore(m_BodyStates);
+    return m_SingleBodies.Insert(std::move(body));
+}
+
+auto Scenario::GetSingleBody(SingleBodyHandle handle) const -> SingleBody* {
+    return m_SingleBodies.Get(handle);
+}
+
+auto Scenario::GetSingleBodyByIndex(size_t index) -> SingleBody::ptr {
+    return m_SingleBodies.GetShared(m_SingleBodies.HandleAt(index));
+}
+
+auto Scenario::PushBodyStates() -> void {
+    LOCO_PROFILE_SCOPE("Scenario::PushBodyStates");
+    const auto NUM_SLOTS = m_SingleBodies.num_slots();
+    for (size_t i = 0; i < NUM_SLOTS; ++i) {
+        if (auto* body = m_SingleBodies.Get(m_SingleBodies.HandleAt(i))) {
+            body->PushState();
+        }
+    }
+}
+
+auto Scenario::num_single_bodies() const -> size_t {
+    return m_SingleBodies.size();
+}
+
+auto Scenario::AddCollider(SingleBodyCollider::ptr collider)
+    -> ColliderHandle {
+    return m_Colliders.Insert(std::move(collider));
+}
+
+auto Scenario::GetCollider(ColliderHandle handle) const
+    -> SingleBodyCollider* {
+    return m_Colliders.Get(handle);
+}
+
+auto Scenario::num_colliders() const -> size_t { return m_Colliders.size(); }
+
 auto Scenario::ToString() const -> std::string {
     return fmt::format(
         "<Scenario\n"
         "  num_drawables={}\n"
-        "  max_drawables={}\n"
+        "  num_single_bodies={}\n"
+        "  num_colliders={}\n"
         ">",
-        m_Drawables.size(), Scenario::MAX_DRAWABLES);
+        m_Drawables.size(), m_SingleBodies.size(), m_Colliders.size());
 }
 
 }  // namespace core
@@ -0,0 +1,165 @@
+#include <loco/core/simulation_batch_t.hpp>
+
+#include <spdlog/fmt/bundled/format.h>
+
+#include <stdexcept>
+
+namespace loco {
+namespace core {
+
+SimulationBatch::SimulationBatch(size_t num_envs,
+                                 const ScenarioFactory& factory,
+                                 eBackendType backend_type)
+    : m_BackendType(backend_type) {
+    if (!factory) {
+        throw std::runtime_error(
+            "SimulationBatch >>> Requires a valid scenario factory");
+    }
+
+    m_Scenarios.reserve(num_envs);
+    m_Simulations.reserve(num_envs);
+    for (size_t i = 0; i < num_envs; ++i) {
+        auto scenario = factory(i);
+        if (scenario == nullptr) {
+            throw std::runtime_error(fmt::format(
+                "SimulationBatch >>> Scenario factory returned nullptr for "
+                "environment {}",
+                i));
+        }
+        m_Simulations.push_back(
+            std::make_unique<Simulation>(scenario, backend_type));
+        m_Scenarios.push_back(std::move(scenario));
+    }
+}
+
+auto SimulationBatch::Init() -> void {
+    for (auto& simulation : m_Simulations) {
+        simulation->Init();
+    }
+    CollectObservations();
+}
+
+auto SimulationBatch::StepAll(Scalar step) -> void {
+    LOCO_PROFILE_SCOPE("SimulationBatch::StepAll");
+    _ForEachEnv([&](size_t i) { m_Simulations[i]->Step(step); });
+    CollectObservations();
+}
+
+auto SimulationBatch::ResetAll() -> void {
+    _ForEachEnv([&](size_t i) { m_Simulations[i]->Reset(); });
+    CollectObservations();
+}
+
+auto SimulationBatch::ResetSome(const std::vector<bool>& mask) -> void {
+    if (mask.size() != m_Simulations.size()) {
+        throw std::runtime_error(fmt::format(
+            "SimulationBatch::ResetSome >>> Mask size ({}) doesn't match the "
+            "number of environments ({})",
+            mask.size(), m_Simulations.size()));
+    }
+
+    _ForEachEnv([&](size_t i) {
+        if (mask[i]) {
+            m_Simulations[i]->Reset();
+        }
+    });
+    for (size_t i = 0; i < m_Simulations.size(); ++i) {
+        if (mask[i]) {
+            _CollectObservation(i);
+        }
+    }
+}
+
+auto SimulationBatch::SetObservationFn(size_t obs_dim, ObservationFn obs_fn)
+    -> void {
+    m_ObsDim = obs_dim;
+    m_ObsFn = std::move(obs_fn);
+    m_Observations.assign(m_Simulations.size() * m_ObsDim, ToScalar(0.0));
+}
+
+auto SimulationBatch::CollectObservations() -> void {
+    if (!m_ObsFn || m_ObsDim == 0) {
+        return;
+    }
+    for (size_t i = 0; i < m_Simulations.size(); ++i) {
+        m_ObsFn(i, *m_Simulations[i], m_Observations.data() + i * m_ObsDim);
+    }
+}
+
+auto SimulationBatch::_CollectObservation(size_t env_index) -> void {
+    if (!m_ObsFn || m_ObsDim == 0) {
+        return;
+    }
+    m_ObsFn(env_index, *m_Simulations[env_index],
+            m_Observations.data() + env_index * m_ObsDim);
+}
+
+auto SimulationBatch::_ForEachEnv(const std::function<void(size_t)>& fn)
+    -> void {
+    if (m_ThreadPool == nullptr) {
+        for (size_t i = 0; i < m_Simulations.size(); ++i) {
+            fn(i);
+        }
+        return;
+    }
+    m_ThreadPool->ParallelFor(m_Simulations.size(), fn);
+}
+
+auto SimulationBatch::SetTimeStep(Scalar step) -> void {
+    for (auto& simulation : m_Simulations) {
+        simulation->SetTimeStep(step);
+    }
+}
+
+auto SimulationBatch::SetGravity(const Vec3& gravity) -> void {
+    for (auto& simulation : m_Simulations) {
+        simulation->SetGravity(gravity);
+    }
+}
+
+auto SimulationBatch::SetThreadPool(ThreadPool::ptr pool) -> void {
+    m_ThreadPool = std::move(pool);
+}
+
+auto SimulationBatch::simulation(size_t env_index) -> Simulation& {
+    if (env_index >= m_Simulations.size()) {
+        throw std::runtime_error(fmt::format(
+            "SimulationBatch::simulation >>> Index {} out of range [0-{})",
+            env_index, m_Simulations.size()));
+    }
+    return *m_Simulations[env_index];
+}
+
+auto SimulationBatch::simulation(size_t env_index) const
+    -> const Simulation& {
+    if (env_index >= m_Simulations.size()) {
+        throw std::runtime_error(fmt::format(
+            "SimulationBatch::simulation >>> Index {} out of range [0-{})",
+            env_index, m_Simulations.size()));
+    }
+    return *m_Simulations[env_index];
+}
+
+auto SimulationBatch::scenario(size_t env_index) const -> Scenario::ptr {
+    if (env_index >= m_Scenarios.size()) {
+        throw std::runtime_error(fmt::format(
+            "SimulationBatch::scenario >>> Index {} out of range [0-{})",
+            env_index, m_Scenarios.size()));
+    }
+    return m_Scenarios[env_index];
+}
+
+auto SimulationBatch::ToString() const -> std::string {
+    return fmt::format(
+        "<SimulationBatch\n"
+        "  num_envs={}\n"
+        "  obs_dim={}\n"
+        "  backend_type={}\n"
+        "  num_workers={}\n"
+        ">",
+        m_Simulations.size(), m_ObsDim, ::loco::ToString(m_BackendType),
+        (m_ThreadPool != nullptr) ? m_ThreadPool->num_workers() : 0);
+}
+
+}  // namespace core
+}  // namespace loco
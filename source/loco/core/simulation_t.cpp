@@ -22,32 +22,43 @@
 #include <loco/backends/dart/simulation_impl_dart.hpp>
 #endif
 
+#include <chrono>
 #include <stdexcept>
 
+#include <spdlog/fmt/bundled/format.h>
+
 namespace loco {
 namespace core {
 
+Simulation::~Simulation() {
+    // Make sure no background step is still using our backend
+    if (m_PendingStep.valid()) {
+        m_PendingStep.wait();
+    }
+}
+
 auto Simulation::Init() -> void {
+    Wait();
     switch (m_BackendType) {
         case eBackendType::NONE:
             m_BackendImpl = std::make_unique<SimulationImplNone>(m_Scenario);
             break;
         case eBackendType::BULLET:
 #if defined(LOCO_BULLET_ENABLED)
-            m_BackendImpl =
-                std::make_unique<bullet::SimulationImplBullet>(m_Scenario);
+            m_BackendImpl = std::make_unique<bullet::SimulationImplBullet>(
+                m_Scenario, m_Config);
 #endif
             break;
         case eBackendType::MUJOCO:
 #if defined(LOCO_MUJOCO_ENABLED)
-            m_BackendImpl =
-                std::make_unique<mujoco::SimulationImplMujoco>(m_Scenario);
+            m_BackendImpl = std::make_unique<mujoco::SimulationImplMujoco>(
+                m_Scenario, m_Config);
 #endif
             break;
         case eBackendType::DART:
 #if defined(LOCO_DART_ENABLED)
-            m_BackendImpl =
-                std::make_unique<dart::SimulationImplDart>(m_Scenario);
+            m_BackendImpl = std::make_unique<dart::SimulationImplDart>(
+                m_Scenario, m_Config);
 #endif
             break;
     }
@@ -60,18 +71,113 @@ auto Simulation::Init() -> void {
 }
 
 auto Simulation::Reset() -> void {
+    Wait();
     if (m_BackendImpl != nullptr) {
         m_BackendImpl->Reset();
     }
 }
 
 auto Simulation::Step(Scalar step) -> void {
-    if (m_BackendImpl != nullptr) {
-        m_BackendImpl->Step(step);
+    LOCO_PROFILE_SCOPE("Simulation::Step");
+    Wait();
+    _StepBackend(step);
+}
+
+auto Simulation::StepAsync(Scalar step) -> StepHandle {
+    Wait();
+    if (m_ThreadPool == nullptr) {
+        m_ThreadPool = std::make_shared<ThreadPool>(1);
+    }
+
+    auto promise = std::make_shared<std::promise<void>>();
+    m_PendingStep = promise->get_future().share();
+    m_ThreadPool->Submit([this, step, promise]() {
+        try {
+            _StepBackend(step);
+            promise->set_value();
+        } catch (...) {
+            promise->set_exception(std::current_exception());
+        }
+    });
+    return m_PendingStep;
+}
+
+auto Simulation::Wait() -> void {
+    if (!m_PendingStep.valid()) {
+        return;
     }
+    // Release the handle before rethrowing any error raised by the step
+    auto pending_step = std::move(m_PendingStep);
+    m_PendingStep = StepHandle();
+    pending_step.get();
+}
+
+auto Simulation::Poll() const -> bool {
+    if (!m_PendingStep.valid()) {
+        return true;
+    }
+    return m_PendingStep.wait_for(std::chrono::seconds(0)) ==
+           std::future_status::ready;
+}
+
+auto Simulation::SetThreadPool(ThreadPool::ptr pool) -> void {
+    Wait();
+    m_ThreadPool = std::move(pool);
+}
+
+auto Simulation::SaveState(uint8_t* buffer, size_t buffer_size) -> void {
+    Wait();
+    if (m_BackendImpl == nullptr) {
+        throw std::runtime_error(
+            "Simulation::SaveState >>> Must initialize the simulation first");
+    }
+    const auto STATE_SIZE = m_BackendImpl->state_size();
+    if (buffer_size < STATE_SIZE) {
+        throw std::runtime_error(fmt::format(
+            "Simulation::SaveState >>> Buffer of {} bytes is too small, a "
+            "snapshot requires {} bytes",
+            buffer_size, STATE_SIZE));
+    }
+    m_BackendImpl->SaveState(buffer);
+}
+
+auto Simulation::SaveState(std::vector<uint8_t>& buffer) -> void {
+    // The size of the state can't be queried while an async step runs
+    Wait();
+    if (m_BackendImpl != nullptr &&
+        buffer.size() != m_BackendImpl->state_size()) {
+        buffer.resize(m_BackendImpl->state_size());
+    }
+    SaveState(buffer.data(), buffer.size());
+}
+
+auto Simulation::LoadState(const uint8_t* buffer, size_t buffer_size)
+    -> void {
+    Wait();
+    if (m_BackendImpl == nullptr) {
+        throw std::runtime_error(
+            "Simulation::LoadState >>> Must initialize the simulation first");
+    }
+    const auto STATE_SIZE = m_BackendImpl->state_size();
+    if (buffer_size != STATE_SIZE) {
+        throw std::runtime_error(fmt::format(
+            "Simulation::LoadState >>> Snapshot of {} bytes doesn't match the "
+            "expected size of {} bytes",
+            buffer_size, STATE_SIZE));
+    }
+    m_BackendImpl->LoadState(buffer);
+}
+
+auto Simulation::LoadState(const std::vector<uint8_t>& buffer) -> void {
+    LoadState(buffer.data(), buffer.size());
+}
+
+auto Simulation::state_size() const -> size_t {
+    return (m_BackendImpl != nullptr) ? m_BackendImpl->state_size() : 0;
 }
 
 auto Simulation::SetTimeStep(Scalar step) -> void {
+    Wait();
     m_TimeStep = step;
     if (m_BackendImpl != nullptr) {
         m_BackendImpl->SetTimeStep(step);
@@ -79,12 +185,34 @@ auto Simulation::SetTimeStep(Scalar step) -> void {
 }
 
 auto Simulation::SetGravity(const Vec3& gravity) -> void {
+    Wait();
     m_Gravity = gravity;
     if (m_BackendImpl != nullptr) {
         m_BackendImpl->SetGravity(gravity);
     }
 }
 
+auto Simulation::stats() const -> const SimulationStats& {
+    if (m_BackendImpl == nullptr) {
+        throw std::runtime_error(
+            "Simulation::stats >>> Must initialize the simulation first");
+    }
+    return m_BackendImpl->stats();
+}
+
+auto Simulation::_StepBackend(Scalar step) -> void {
+    if (m_BackendImpl == nullptr) {
+        return;
+    }
+    const auto START = std::chrono::steady_clock::now();
+    m_BackendImpl->Step(step);
+    const auto END = std::chrono::steady_clock::now();
+
+    auto& stats = m_BackendImpl->stats();
+    stats.step_time = std::chrono::duration<double>(END - START).count();
+    stats.num_steps++;
+}
+
 auto Simulation::impl() -> SimulationImpl& {
     if (m_BackendImpl == nullptr) {
         throw std::runtime_error(
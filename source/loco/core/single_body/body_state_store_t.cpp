@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include <spdlog/fmt/bundled/format.h>
+
+#include <loco/core/single_body/body_state_store_t.hpp>
+
+namespace loco {
+namespace core {
+
+namespace {
+/// Reads the vec3 stored at the given index of an array of vec3s
+auto ReadVec3(const std::vector<Scalar>& array, size_t index) -> Vec3 {
+    const auto* ptr = array.data() + BodyStateStore::DIM_VEC3 * index;
+    return {ptr[0], ptr[1], ptr[2]};
+}
+
+/// Writes the given vec3 at the given index of an array of vec3s
+auto WriteVec3(std::vector<Scalar>& array, size_t index, const Vec3& vec)
+    -> void {
+    auto* ptr = array.data() + BodyStateStore::DIM_VEC3 * index;
+    ptr[0] = vec.x();
+    ptr[1] = vec.y();
+    ptr[2] = vec.z();
+}
+}  // namespace
+
+BodyStateStore::BodyStateStore(size_t capacity)
+    : m_Capacity(capacity),
+      m_Positions(DIM_POSITION * capacity, ToScalar(0.0)),
+      m_Orientations(DIM_ORIENTATION * capacity, ToScalar(0.0)),
+      m_LinearVels(DIM_VEC3 * capacity, ToScalar(0.0)),
+      m_AngularVels(DIM_VEC3 * capacity, ToScalar(0.0)),
+      m_Forces(DIM_VEC3 * capacity, ToScalar(0.0)),
+      m_Torques(DIM_VEC3 * capacity, ToScalar(0.0)) {
+    m_SlotTaken.resize(capacity, false);
+    for (size_t i = 0; i < capacity; ++i) {
+        m_Orientations[DIM_ORIENTATION * i] = ToScalar(1.0);
+    }
+}
+
+auto BodyStateStore::Allocate() -> size_t {
+    size_t index = m_Size;
+    if (!m_FreeSlots.empty()) {
+        index = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+    } else if (m_Size < m_Capacity) {
+        m_Size++;
+    } else {
+        throw std::runtime_error(fmt::format(
+            "BodyStateStore::Allocate >>> The store is full ({} bodies). "
+            "Create it with a larger capacity to add more bodies",
+            m_Capacity));
+    }
+    m_SlotTaken[index] = true;
+    return index;
+}
+
+auto BodyStateStore::Release(size_t index) -> void {
+    if (index >= m_Size || !m_SlotTaken[index]) {
+        throw std::runtime_error(fmt::format(
+            "BodyStateStore::Release >>> Slot {} isn't in use", index));
+    }
+    _ResetSlot(index);
+    m_SlotTaken[index] = false;
+    m_FreeSlots.push_back(index);
+}
+
+auto BodyStateStore::ClearForces() -> void {
+    std::fill(m_Forces.begin(), m_Forces.end(), ToScalar(0.0));
+    std::fill(m_Torques.begin(), m_Torques.end(), ToScalar(0.0));
+}
+
+auto BodyStateStore::GetPosition(size_t index) const -> Vec3 {
+    return ReadVec3(m_Positions, index);
+}
+
+auto BodyStateStore::GetOrientation(size_t index) const -> Quat {
+    const auto* ptr = m_Orientations.data() + DIM_ORIENTATION * index;
+    return {ptr[0], ptr[1], ptr[2], ptr[3]};
+}
+
+auto BodyStateStore::GetPose(size_t index) const -> Pose {
+    return Pose(GetPosition(index), GetOrientation(index));
+}
+
+auto BodyStateStore::GetLinearVel(size_t index) const -> Vec3 {
+    return ReadVec3(m_LinearVels, index);
+}
+
+auto BodyStateStore::GetAngularVel(size_t index) const -> Vec3 {
+    return ReadVec3(m_AngularVels, index);
+}
+
+auto BodyStateStore::GetForce(size_t index) const -> Vec3 {
+    return ReadVec3(m_Forces, index);
+}
+
+auto BodyStateStore::GetTorque(size_t index) const -> Vec3 {
+    return ReadVec3(m_Torques, index);
+}
+
+auto BodyStateStore::SetPosition(size_t index, const Vec3& position) -> void {
+    WriteVec3(m_Positions, index, position);
+}
+
+auto BodyStateStore::SetOrientation(size_t index, const Quat& orientation)
+    -> void {
+    auto* ptr = m_Orientations.data() + DIM_ORIENTATION * index;
+    ptr[0] = orientation.w();
+    ptr[1] = orientation.x();
+    ptr[2] = orientation.y();
+    ptr[3] = orientation.z();
+}
+
+auto BodyStateStore::SetPose(size_t index, const Pose& pose) -> void {
+    SetPosition(index, pose.position);
+    SetOrientation(index, pose.orientation);
+}
+
+auto BodyStateStore::SetLinearVel(size_t index, const Vec3& linear_vel)
+    -> void {
+    WriteVec3(m_LinearVels, index, linear_vel);
+}
+
+auto BodyStateStore::SetAngularVel(size_t index, const Vec3& angular_vel)
+    -> void {
+    WriteVec3(m_AngularVels, index, angular_vel);
+}
+
+auto BodyStateStore::SetForce(size_t index, const Vec3& force) -> void {
+    WriteVec3(m_Forces, index, force);
+}
+
+auto BodyStateStore::SetTorque(size_t index, const Vec3& torque) -> void {
+    WriteVec3(m_Torques, index, torque);
+}
+
+auto BodyStateStore::ToString() const -> std::string {
+    return fmt::format(
+        "<BodyStateStore\n"
+        "  size={}\n"
+        "  num_bodies={}\n"
+        "  capacity={}\n"
+        ">",
+        m_Size, num_bodies(), m_Capacity);
+}
+
+auto BodyStateStore::_ResetSlot(size_t index) -> void {
+    const Vec3 zero(ToScalar(0.0), ToScalar(0.0), ToScalar(0.0));
+    SetPose(index, Pose(zero, Quat(1.0, 0.0, 0.0, 0.0)));
+    SetLinearVel(index, zero);
+    SetAngularVel(index, zero);
+    SetForce(index, zero);
+    SetTorque(index, zero);
+}
+
+}  // namespace core
+}  // namespace loco
@@ -19,21 +19,22 @@ auto SingleBodyCollider::ChangeVertexData(size_t num_vertices,
                                           const Scalar* ptr_vertices,
                                           size_t num_faces,
                                           const uint32_t* ptr_faces) -> void {
-    // Resize the buffer to its new storage size if required
+    // Resize the buffer to its new storage size if required (otherwise write
+    // in place, unless the buffer is shared with other copies of the mesh)
     if (m_Data.mesh_data.n_vertices != num_vertices) {
         m_Data.mesh_data.n_vertices = num_vertices;
-        m_Data.mesh_data.vertices =
-            std::make_unique<Scalar[]>(3 * num_vertices);  // NOLINT
+        m_Data.mesh_data.vertices = SharedBuffer<Scalar>(3 * num_vertices);
     }
     if (m_Data.mesh_data.n_faces != num_faces) {
         m_Data.mesh_data.n_faces = num_faces;
-        m_Data.mesh_data.faces =
-            std::make_unique<uint32_t[]>(3 * num_faces);  // NOLINT
+        m_Data.mesh_data.faces = SharedBuffer<uint32_t>(3 * num_faces);
     }
-    memcpy(m_Data.mesh_data.vertices.get(), ptr_vertices,
+    memcpy(m_Data.mesh_data.vertices.mutable_data(), ptr_vertices,
            sizeof(Scalar) * 3 * num_vertices);
-    memcpy(m_Data.mesh_data.faces.get(), ptr_faces,
+    memcpy(m_Data.mesh_data.faces.mutable_data(), ptr_faces,
            sizeof(uint32_t) * 3 * num_faces);
+    // The mesh is now unique to this collider (not the cached one anymore)
+    m_AssetKey = 0;
 
     if (m_BackendImpl != nullptr) {
         m_BackendImpl->ChangeVertexData(num_vertices, ptr_vertices, num_faces,
@@ -51,11 +52,12 @@ auto SingleBodyCollider::ChangeElevationData(size_t n_width_samples,
         m_Data.hfield_data.n_depth_samples != n_depth_samples) {
         m_Data.hfield_data.n_width_samples = n_width_samples;
         m_Data.hfield_data.n_depth_samples = n_depth_samples;
-        // NOLINTNEXTLINE
-        m_Data.hfield_data.heights = std::make_unique<Scalar[]>(N_GRID_SAMPLES);
+        m_Data.hfield_data.heights = SharedBuffer<Scalar>(N_GRID_SAMPLES);
     }
-    memcpy(m_Data.hfield_data.heights.get(), ptr_heights,
+    memcpy(m_Data.hfield_data.heights.mutable_data(), ptr_heights,
            sizeof(Scalar) * N_GRID_SAMPLES);
+    // The hfield is now unique to this collider (not the cached one anymore)
+    m_AssetKey = 0;
 
     if (m_BackendImpl != nullptr) {
         m_BackendImpl->ChangeElevationData(n_width_samples, n_depth_samples,
@@ -63,6 +65,18 @@ auto SingleBodyCollider::ChangeElevationData(size_t n_width_samples,
     }
 }
 
+auto SingleBodyCollider::ChangeElevationRegion(const HeightfieldRegion& region,
+                                               const Scalar* ptr_heights)
+    -> void {
+    WriteElevationRegion(m_Data.hfield_data, region, ptr_heights);
+    // The hfield is now unique to this collider (not the cached one anymore)
+    m_AssetKey = 0;
+
+    if (m_BackendImpl != nullptr) {
+        m_BackendImpl->ChangeElevationRegion(region, ptr_heights);
+    }
+}
+
 auto SingleBodyCollider::ChangeCollisionGroup(int32_t col_group) -> void {
     m_Data.collision_group = col_group;
     if (m_BackendImpl != nullptr) {
@@ -9,6 +9,22 @@
 namespace loco {
 namespace core {
 
+SingleBody::SingleBody(::loco::BodyData data, const Pose& p_pose)
+    : m_Data(std::move(data)) {
+    m_LocalState.pose = p_pose;
+}
+
+SingleBody::~SingleBody() {
+    // Give our slot back, in case the store is shared with other bodies
+    if (m_States != nullptr) {
+        m_States->Release(m_StateIndex);
+    }
+}
+
+SingleBody::SingleBody(::loco::BodyData data, const Vec3& p_position,
+                       const Quat& p_orientation)
+    : SingleBody(std::move(data), Pose(p_position, p_orientation)) {}
+
 auto SingleBody::Initialize(const eBackendType& backend_type) -> void {
     m_BackendType = backend_type;
 
@@ -38,57 +54,138 @@ auto SingleBody::SetAdapter(ISingleBodyImpl::uptr adapter) -> void {
     m_BackendImpl = std::move(adapter);
 }
 
+auto SingleBody::SetStateStore(BodyStateStore::ptr store) -> void {
+    if (store == nullptr || store == m_States) {
+        return;
+    }
+    // Copy our current state into a new slot of the given store
+    const auto NEW_INDEX = store->Allocate();
+    store->SetPose(NEW_INDEX, pose());
+    store->SetLinearVel(NEW_INDEX, linear_vel());
+    store->SetAngularVel(NEW_INDEX, angular_vel());
+    store->SetForce(NEW_INDEX, total_force_com());
+    store->SetTorque(NEW_INDEX, total_torque());
+
+    if (m_States != nullptr) {
+        m_States->Release(m_StateIndex);
+    }
+    m_States = std::move(store);
+    m_StateIndex = NEW_INDEX;
+}
+
 auto SingleBody::Reset() -> void {
     // TODO(wilbert): expose Vec3::ZERO, Vec3::X, Vec3::Y, and Vec3::Z
-    totalTorque = Vec3(ToScalar(0.0), ToScalar(0.0), ToScalar(0.0));
-    totalForceCOM = Vec3(ToScalar(0.0), ToScalar(0.0), ToScalar(0.0));
-
-    m_Pose = pose0;
-    m_LinearVel = linearVel0;
-    m_AngularVel = angularVel0;
+    const Vec3 zero(ToScalar(0.0), ToScalar(0.0), ToScalar(0.0));
+    if (m_States != nullptr) {
+        m_States->SetForce(m_StateIndex, zero);
+        m_States->SetTorque(m_StateIndex, zero);
+        m_States->SetPose(m_StateIndex, pose0);
+        m_States->SetLinearVel(m_StateIndex, linearVel0);
+        m_States->SetAngularVel(m_StateIndex, angularVel0);
+    } else {
+        m_LocalState.force = zero;
+        m_LocalState.torque = zero;
+        m_LocalState.pose = pose0;
+        m_LocalState.linear_vel = linearVel0;
+        m_LocalState.angular_vel = angularVel0;
+    }
 
     if (m_BackendImpl != nullptr) {
-        m_BackendImpl->SetPose(m_Pose);
-        m_BackendImpl->SetLinearVelocity(m_LinearVel);
-        m_BackendImpl->SetAngularVelocity(m_AngularVel);
+        m_BackendImpl->SetPose(pose0);
+        m_BackendImpl->SetLinearVelocity(linearVel0);
+        m_BackendImpl->SetAngularVelocity(angularVel0);
     }
 }
 
 auto SingleBody::SetPose(const Pose& pose) -> void {
-    m_Pose = pose;
+    if (m_States != nullptr) {
+        m_States->SetPose(m_StateIndex, pose);
+    } else {
+        m_LocalState.pose = pose;
+    }
     if (m_BackendImpl != nullptr) {
         m_BackendImpl->SetPose(pose);
     }
 }
 
 auto SingleBody::SetPosition(const Vec3& pos) -> void {
-    m_Pose.position = pos;
+    if (m_States != nullptr) {
+        m_States->SetPosition(m_StateIndex, pos);
+    } else {
+        m_LocalState.pose.position = pos;
+    }
     if (m_BackendImpl != nullptr) {
-        m_BackendImpl->SetPose(m_Pose);
+        m_BackendImpl->SetPose(pose());
     }
 }
 
 auto SingleBody::SetOrientation(const Quat& quat) -> void {
-    m_Pose.orientation = quat;
+    if (m_States != nullptr) {
+        m_States->SetOrientation(m_StateIndex, quat);
+    } else {
+        m_LocalState.pose.orientation = quat;
+    }
     if (m_BackendImpl != nullptr) {
-        m_BackendImpl->SetPose(m_Pose);
+        m_BackendImpl->SetPose(pose());
     }
 }
 
 auto SingleBody::SetLinearVelocity(const Vec3& linear_vel) -> void {
-    m_LinearVel = linear_vel;
+    if (m_States != nullptr) {
+        m_States->SetLinearVel(m_StateIndex, linear_vel);
+    } else {
+        m_LocalState.linear_vel = linear_vel;
+    }
     if (m_BackendImpl != nullptr) {
         m_BackendImpl->SetLinearVelocity(linear_vel);
     }
 }
 
 auto SingleBody::SetAngularVelocity(const Vec3& angular_vel) -> void {
-    m_AngularVel = angular_vel;
+    if (m_States != nullptr) {
+        m_States->SetAngularVel(m_StateIndex, angular_vel);
+    } else {
+        m_LocalState.angular_vel = angular_vel;
+    }
     if (m_BackendImpl != nullptr) {
         m_BackendImpl->SetAngularVelocity(angular_vel);
     }
 }
 
+auto SingleBody::PushState() -> void {
+    if (m_BackendImpl == nullptr) {
+        return;
+    }
+    LOCO_PROFILE_SCOPE("SingleBody::PushState");
+    m_BackendImpl->SetPose(pose());
+    m_BackendImpl->SetLinearVelocity(linear_vel());
+    m_BackendImpl->SetAngularVelocity(angular_vel());
+    m_BackendImpl->SetForceCOM(total_force_com());
+    m_BackendImpl->SetTorque(total_torque());
+}
+
+auto SingleBody::SetTotalForceCOM(const Vec3& force) -> void {
+    if (m_States != nullptr) {
+        m_States->SetForce(m_StateIndex, force);
+    } else {
+        m_LocalState.force = force;
+    }
+    if (m_BackendImpl != nullptr) {
+        m_BackendImpl->SetForceCOM(force);
+    }
+}
+
+auto SingleBody::SetTotalTorque(const Vec3& torque) -> void {
+    if (m_States != nullptr) {
+        m_States->SetTorque(m_StateIndex, torque);
+    } else {
+        m_LocalState.torque = torque;
+    }
+    if (m_BackendImpl != nullptr) {
+        m_BackendImpl->SetTorque(torque);
+    }
+}
+
 auto SingleBody::impl() -> ISingleBodyImpl& {
     if (m_BackendImpl == nullptr) {
         throw std::runtime_error(
@@ -115,8 +212,8 @@ auto SingleBody::ToString() const -> std::string {
         "  linear_vel: {2}\n"
         "  angular_vel: {3}\n"
         ">\n",
-        m_Pose.position.toString(), m_Pose.orientation.toString(),
-        m_LinearVel.toString(), m_AngularVel.toString());
+        position().toString(), orientation().toString(),
+        linear_vel().toString(), angular_vel().toString());
 }
 
 }  // namespace core
@@ -0,0 +1,288 @@
+#include <loco/core/thread_pool_t.hpp>
+
+#include <spdlog/fmt/bundled/format.h>
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace loco {
+namespace core {
+
+namespace {
+/// The pool the current thread works for (nullptr if not a worker thread)
+thread_local const ThreadPool* t_CurrentPool = nullptr;
+/// The index of the current thread in the pool it works for
+thread_local size_t t_WorkerIndex = 0;
+/// The pool whose task the current thread is running (workers, or threads
+/// helping while they wait), nullptr if not running any task
+thread_local const ThreadPool* t_TaskPool = nullptr;
+}  // namespace
+
+ThreadPool::ThreadPool(size_t num_workers, bool pin_to_cores)
+    : m_PinToCores(pin_to_cores) {
+    if (num_workers == 0) {
+        num_workers = std::max(1U, std::thread::hardware_concurrency());
+    }
+
+    m_Queues.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        m_Queues.push_back(std::make_unique<WorkQueue>());
+    }
+
+    m_Workers.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        m_Workers.emplace_back([this, i]() { _WorkerLoop(i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_WakeMutex);
+        m_Stop = true;
+    }
+    m_WakeCondition.notify_all();
+    for (auto& worker : m_Workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+auto ThreadPool::Submit(Task task) -> void {
+    // Workers push into their own queue, others distribute in round-robin
+    const auto NUM_QUEUES = m_Queues.size();
+    const auto QUEUE_INDEX = (t_CurrentPool == this)
+                                 ? t_WorkerIndex
+                                 : m_NextQueue.fetch_add(1) % NUM_QUEUES;
+
+    m_NumPending.fetch_add(1);
+    {
+        // Count the task only once it's in the queue (and under the lock of
+        // the queue, so it can't be popped before it's counted), so threads
+        // woken up by the count always find it
+        auto& queue = *m_Queues[QUEUE_INDEX];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+        m_NumQueued.fetch_add(1);
+    }
+    {
+        // Sleepers check the count under this lock, so taking it here ensures
+        // they are either already waiting (and get notified) or see the task
+        std::lock_guard<std::mutex> lock(m_WakeMutex);
+    }
+    m_WakeCondition.notify_one();
+    // Threads blocked in WaitIdle() or ParallelFor() help run queued tasks
+    m_IdleCondition.notify_all();
+}
+
+auto ThreadPool::ParallelFor(size_t count,
+                             const std::function<void(size_t)>& fn) -> void {
+    if (count == 0) {
+        return;
+    }
+    if (count == 1) {
+        fn(0);
+        return;
+    }
+
+    std::atomic<size_t> remaining{count};
+    std::mutex error_mutex;
+    std::exception_ptr error = nullptr;
+    for (size_t i = 0; i < count; ++i) {
+        Submit([&, i]() {
+            try {
+                fn(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (error == nullptr) {
+                    error = std::current_exception();
+                }
+            }
+            if (remaining.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(m_WakeMutex);
+                m_IdleCondition.notify_all();
+            }
+        });
+    }
+
+    // Help the workers while waiting, instead of just blocking this thread
+    Task task;
+    while (remaining.load() > 0) {
+        if (_TryAcquire(task)) {
+            _RunTask(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(m_WakeMutex);
+        m_IdleCondition.wait(lock, [&]() {
+            return remaining.load() == 0 || m_NumQueued.load() > 0;
+        });
+    }
+
+    if (error != nullptr) {
+        std::rethrow_exception(error);
+    }
+}
+
+auto ThreadPool::WaitIdle() -> void {
+    // The calling task counts as pending, so the pool would never be idle
+    if (t_TaskPool == this) {
+        throw std::runtime_error(
+            "ThreadPool::WaitIdle >>> Can't wait for the pool to be idle from "
+            "within one of its tasks (use ParallelFor for nested jobs)");
+    }
+
+    Task task;
+    while (m_NumPending.load() > 0) {
+        if (_TryAcquire(task)) {
+            _RunTask(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(m_WakeMutex);
+        m_IdleCondition.wait(lock, [this]() {
+            return m_NumPending.load() == 0 || m_NumQueued.load() > 0;
+        });
+    }
+}
+
+auto ThreadPool::ToString() const -> std::string {
+    return fmt::format(
+        "<ThreadPool\n"
+        "  num_workers={}\n"
+        "  pinned={}\n"
+        "  num_pending={}\n"
+        ">",
+        m_Workers.size(), m_PinToCores, m_NumPending.load());
+}
+
+auto ThreadPool::_WorkerLoop(size_t worker_index) -> void {
+    t_CurrentPool = this;
+    t_WorkerIndex = worker_index;
+    if (m_PinToCores) {
+        _PinWorker(worker_index);
+    }
+
+    Task task;
+    while (true) {
+        if (_TryPop(worker_index, task) || _TrySteal(worker_index, task)) {
+            _RunTask(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_WakeMutex);
+        m_WakeCondition.wait(
+            lock, [this]() { return m_Stop || m_NumQueued.load() > 0; });
+        if (m_Stop && m_NumQueued.load() == 0) {
+            return;
+        }
+    }
+}
+
+auto ThreadPool::_TryPop(size_t worker_index, Task& task) -> bool {
+    auto& queue = *m_Queues[worker_index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    m_NumQueued.fetch_sub(1);
+    return true;
+}
+
+auto ThreadPool::_TrySteal(size_t thief_index, Task& task) -> bool {
+    const auto NUM_QUEUES = m_Queues.size();
+    for (size_t k = 0; k < NUM_QUEUES; ++k) {
+        const auto VICTIM_INDEX = (thief_index + 1 + k) % NUM_QUEUES;
+        if (VICTIM_INDEX == thief_index) {
+            continue;
+        }
+        auto& queue = *m_Queues[VICTIM_INDEX];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            continue;
+        }
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        m_NumQueued.fetch_sub(1);
+        return true;
+    }
+    return false;
+}
+
+auto ThreadPool::_TryAcquire(Task& task) -> bool {
+    if (t_CurrentPool == this) {
+        return _TryPop(t_WorkerIndex, task) || _TrySteal(t_WorkerIndex, task);
+    }
+    // Non-worker threads don't own a queue, so they can steal from all
+    return _TrySteal(m_Queues.size(), task);
+}
+
+auto ThreadPool::_RunTask(Task& task) -> void {
+    const auto* parent_pool = t_TaskPool;
+    t_TaskPool = this;
+    try {
+        task();
+    } catch (const std::exception& e) {
+        LOCO_CORE_ERROR("ThreadPool >>> Uncaught exception in task: {}",
+                        e.what());
+    } catch (...) {
+        LOCO_CORE_ERROR("ThreadPool >>> Uncaught unknown exception in task");
+    }
+    t_TaskPool = parent_pool;
+    task = nullptr;
+
+    if (m_NumPending.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> lock(m_WakeMutex);
+        m_IdleCondition.notify_all();
+    }
+}
+
+auto ThreadPool::_PinWorker(size_t worker_index) -> void {
+#if defined(__linux__)
+    // Only use the cores we're allowed to run on (e.g. in a container or a
+    // job restricted by a cpuset), which workers inherit from their creator
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &allowed) != 0 ||
+        CPU_COUNT(&allowed) == 0) {
+        LOCO_CORE_WARN(
+            "ThreadPool >>> Couldn't get the allowed cores to pin worker {}",
+            worker_index);
+        return;
+    }
+    // Take the n-th allowed core, wrapping around if there are more workers
+    auto nth_core = worker_index % static_cast<size_t>(CPU_COUNT(&allowed));
+    int core = 0;
+    for (; core < CPU_SETSIZE; ++core) {
+        if (CPU_ISSET(core, &allowed)) {
+            if (nth_core == 0) {
+                break;
+            }
+            nth_core--;
+        }
+    }
+
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(core, &cpuset);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) !=
+        0) {
+        LOCO_CORE_WARN("ThreadPool >>> Couldn't pin worker {} to core {}",
+                       worker_index, core);
+    }
+#else
+    LOCO_CORE_WARN(
+        "ThreadPool >>> Pinning workers to cores is not supported on this "
+        "platform (requested for worker {})",
+        worker_index);
+#endif
+}
+
+}  // namespace core
+}  // namespace loco
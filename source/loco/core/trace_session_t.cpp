@@ -0,0 +1,274 @@
+#include <loco/core/trace_session_t.hpp>
+
+#include <spdlog/fmt/bundled/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+namespace loco {
+namespace core {
+
+namespace {
+static_assert((TraceSession::BUFFER_CAPACITY &
+               (TraceSession::BUFFER_CAPACITY - 1)) == 0,
+              "TraceSession::BUFFER_CAPACITY must be a power of two");
+
+/// \brief Slot of a ring buffer, holding a single event
+///
+/// Slots can be read by Collect() while their owner overwrites them, so all
+/// fields are (relaxed) atomics, and the sequence number works as a seqlock:
+/// it's odd while the slot is being written, and 2 * (n + 1) once the n-th
+/// event recorded into the buffer is complete
+struct TraceSlot {
+    /// Sequence number of the slot (see above)
+    std::atomic<uint64_t> sequence{0};
+    /// Name of the scope
+    std::atomic<const char*> name{nullptr};
+    /// Category of the scope
+    std::atomic<const char*> category{nullptr};
+    /// Index of the thread that recorded the event
+    std::atomic<uint32_t> thread_index{0};
+    /// Time at which the scope was entered
+    std::atomic<int64_t> start_ns{0};
+    /// Time spent inside the scope
+    std::atomic<int64_t> duration_ns{0};
+};
+
+/// Ring buffer of events, written only by the thread that owns it
+struct ThreadBuffer {
+    explicit ThreadBuffer(uint32_t index)
+        : thread_index(index), slots(TraceSession::BUFFER_CAPACITY) {}
+
+    /// Index of the owning thread (in order of registration), which changes
+    /// when the buffer is handed to a new thread
+    std::atomic<uint32_t> thread_index{0};
+    /// Storage for the latest events recorded by the owning thread
+    std::vector<TraceSlot> slots;
+    /// Total number of events recorded so far (next slot is head % capacity)
+    std::atomic<uint64_t> head{0};
+    /// Value of the head when the current (or last) session began (the events
+    /// before it belong to previous sessions)
+    std::atomic<uint64_t> session_head{0};
+    /// Whether or not a live thread owns this buffer (otherwise reusable)
+    std::atomic<bool> owned{true};
+};
+
+/// Keeps the buffers of all threads alive (even after their threads exit)
+struct BufferRegistry {
+    /// Mutex used to protect the access to the list of buffers
+    std::mutex mutex;
+    /// The buffers of all threads that have recorded at least one event
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    /// Number of threads that registered a buffer so far
+    uint32_t num_threads = 0;
+};
+
+/// Whether or not a session is currently recording events
+std::atomic<bool> g_Active{false};
+/// Time at which the current (or last) session started
+std::atomic<int64_t> g_SessionStart{0};
+/// Time at which the last session ended (max value while still active)
+std::atomic<int64_t> g_SessionEnd{0};
+
+/// Hands the buffer of a thread back to the registry when the thread exits
+struct BufferHandle {
+    ~BufferHandle() {
+        if (buffer != nullptr) {
+            buffer->owned.store(false);
+        }
+    }
+
+    /// The buffer owned by the calling thread (nullptr until its first event)
+    ThreadBuffer* buffer = nullptr;
+};
+
+/// The handle to the buffer owned by the calling thread
+thread_local BufferHandle t_Handle;
+
+auto GetRegistry() -> BufferRegistry& {
+    static BufferRegistry s_Registry;
+    return s_Registry;
+}
+
+auto RegisterThreadBuffer() -> ThreadBuffer* {
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    // Reuse the buffers of threads that already exited, if there are any.
+    // The new owner gets its own index (the events of the previous owner are
+    // kept, with the index of the previous owner)
+    const auto INDEX = registry.num_threads++;
+    for (auto& buffer : registry.buffers) {
+        bool expected = false;
+        if (buffer->owned.compare_exchange_strong(expected, true)) {
+            buffer->thread_index.store(INDEX, std::memory_order_relaxed);
+            return buffer.get();
+        }
+    }
+    registry.buffers.push_back(std::make_unique<ThreadBuffer>(INDEX));
+    return registry.buffers.back().get();
+}
+
+/// Escapes the characters of the given string that aren't valid in JSON
+auto EscapeJson(const char* str) -> std::string {
+    std::string escaped;
+    for (const char* ch = str; ch != nullptr && *ch != '\0'; ++ch) {
+        switch (*ch) {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            default:
+                escaped += *ch;
+                break;
+        }
+    }
+    return escaped;
+}
+}  // namespace
+
+auto TraceSession::Begin() -> void {
+    {
+        // Discard the events of previous sessions
+        auto& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (auto& buffer : registry.buffers) {
+            buffer->session_head.store(
+                buffer->head.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+        }
+    }
+    g_SessionEnd.store(std::numeric_limits<int64_t>::max());
+    g_SessionStart.store(Now());
+    g_Active.store(true, std::memory_order_release);
+}
+
+auto TraceSession::End() -> void {
+    g_Active.store(false, std::memory_order_release);
+    g_SessionEnd.store(Now());
+}
+
+auto TraceSession::IsActive() -> bool {
+    return g_Active.load(std::memory_order_relaxed);
+}
+
+auto TraceSession::Now() -> int64_t {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+auto TraceSession::Record(const char* name, const char* category,
+                          int64_t start_ns, int64_t end_ns) -> void {
+    auto* buffer = t_Handle.buffer;
+    if (buffer == nullptr) {
+        buffer = t_Handle.buffer = RegisterThreadBuffer();
+    }
+
+    // Single producer: only this thread moves the head of its own buffer
+    const auto HEAD = buffer->head.load(std::memory_order_relaxed);
+    auto& slot = buffer->slots[HEAD & (BUFFER_CAPACITY - 1)];
+    slot.sequence.store(2 * HEAD + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.category.store(category, std::memory_order_relaxed);
+    slot.thread_index.store(
+        buffer->thread_index.load(std::memory_order_relaxed),
+        std::memory_order_relaxed);
+    slot.start_ns.store(start_ns, std::memory_order_relaxed);
+    slot.duration_ns.store(end_ns - start_ns, std::memory_order_relaxed);
+    slot.sequence.store(2 * (HEAD + 1), std::memory_order_release);
+    buffer->head.store(HEAD + 1, std::memory_order_release);
+}
+
+auto TraceSession::Collect() -> std::vector<TraceEvent> {
+    const auto SESSION_START = g_SessionStart.load();
+    const auto SESSION_END = g_SessionEnd.load();
+
+    std::vector<TraceEvent> collected;
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (const auto& buffer : registry.buffers) {
+        const auto HEAD = buffer->head.load(std::memory_order_acquire);
+        const auto FIRST =
+            std::max(buffer->session_head.load(std::memory_order_relaxed),
+                     (HEAD > BUFFER_CAPACITY) ? HEAD - BUFFER_CAPACITY
+                                              : uint64_t{0});
+        for (auto i = FIRST; i < HEAD; ++i) {
+            const auto& slot = buffer->slots[i & (BUFFER_CAPACITY - 1)];
+            const auto SEQUENCE = slot.sequence.load(std::memory_order_acquire);
+            TraceEvent event;
+            event.name = slot.name.load(std::memory_order_relaxed);
+            event.category = slot.category.load(std::memory_order_relaxed);
+            event.thread_index =
+                slot.thread_index.load(std::memory_order_relaxed);
+            event.start_ns = slot.start_ns.load(std::memory_order_relaxed);
+            event.duration_ns =
+                slot.duration_ns.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            // Drop the slots that the owner overwrote while we were copying
+            // them (or is writing into right now)
+            if (SEQUENCE == 2 * (i + 1) &&
+                slot.sequence.load(std::memory_order_relaxed) == SEQUENCE) {
+                collected.push_back(event);
+            }
+        }
+    }
+
+    collected.erase(std::remove_if(collected.begin(), collected.end(),
+                                   [&](const TraceEvent& event) {
+                                       return event.start_ns < SESSION_START ||
+                                              event.start_ns > SESSION_END;
+                                   }),
+                    collected.end());
+    std::sort(collected.begin(), collected.end(),
+              [](const TraceEvent& lhs, const TraceEvent& rhs) {
+                  return lhs.start_ns < rhs.start_ns;
+              });
+    return collected;
+}
+
+auto TraceSession::ToChromeTrace() -> std::string {
+    const auto SESSION_START = g_SessionStart.load();
+    const auto events = Collect();
+
+    // Timestamps are given in microseconds, relative to the session start
+    std::string json = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    for (size_t i = 0; i < events.size(); ++i) {
+        const auto& event = events[i];
+        fmt::format_to(
+            std::back_inserter(json),
+            "{}{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"X\",\"pid\":0,"
+            "\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+            (i > 0) ? ",\n" : "\n", EscapeJson(event.name),
+            EscapeJson(event.category), event.thread_index,
+            1e-3 * static_cast<double>(event.start_ns - SESSION_START),
+            1e-3 * static_cast<double>(event.duration_ns));
+    }
+    json += "\n]}\n";
+    return json;
+}
+
+auto TraceSession::WriteChromeTrace(const std::string& filepath) -> void {
+    std::ofstream file(filepath);
+    if (!file.is_open()) {
+        throw std::runtime_error(fmt::format(
+            "TraceSession::WriteChromeTrace >>> Couldn't open file '{}'",
+            filepath));
+    }
+    file << ToChromeTrace();
+}
+
+}  // namespace core
+}  // namespace loco
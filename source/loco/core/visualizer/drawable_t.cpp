@@ -18,46 +18,71 @@ auto Drawable::SetAdapter(IDrawableImpl::uptr adapter) -> void {
     m_BackendImpl = std::move(adapter);
 }
 
-auto Drawable::SetVisible(bool visible) -> void {
-    m_Visible = visible;
-    if (m_BackendImpl != nullptr) {
+auto Drawable::SetDirtyTracking(DirtyBitset::ptr dirty_set, size_t index)
+    -> void {
+    SyncAdapter();
+    m_DirtySet = std::move(dirty_set);
+    m_DirtyIndex = index;
+}
+
+auto Drawable::SyncAdapter() -> void {
+    const auto FLAGS = m_DirtyFlags;
+    m_DirtyFlags = 0;
+    if (m_BackendImpl == nullptr || FLAGS == 0) {
+        return;
+    }
+    if ((FLAGS & DIRTY_POSE) != 0) {
+        LOCO_PROFILE_SCOPE("Drawable::SyncPose");
+        m_BackendImpl->SetPose(m_Pose);
+    }
+    if ((FLAGS & DIRTY_COLOR) != 0) {
+        m_BackendImpl->SetColor(m_Data.color);
+    }
+    if ((FLAGS & DIRTY_VISIBILITY) != 0) {
         m_BackendImpl->SetVisible(m_Visible);
     }
+    if ((FLAGS & DIRTY_WIREFRAME) != 0) {
+        m_BackendImpl->SetWireframe(m_Wireframe);
+    }
+}
+
+auto Drawable::_MarkDirty(uint8_t flags) -> void {
+    m_DirtyFlags |= flags;
+    if (m_DirtySet != nullptr) {
+        m_DirtySet->Set(m_DirtyIndex);
+    } else {
+        SyncAdapter();
+    }
+}
+
+auto Drawable::SetVisible(bool visible) -> void {
+    m_Visible = visible;
+    _MarkDirty(DIRTY_VISIBILITY);
 }
 
 auto Drawable::SetWireframe(bool wireframe) -> void {
     m_Wireframe = wireframe;
-    if (m_BackendImpl != nullptr) {
-        m_BackendImpl->SetWireframe(m_Wireframe);
-    }
+    _MarkDirty(DIRTY_WIREFRAME);
 }
 
 auto Drawable::SetPosition(const Vec3& pos) -> void {
     m_Pose.position = pos;
-    if (m_BackendImpl != nullptr) {
-        m_BackendImpl->SetPose(m_Pose);
-    }
+    _MarkDirty(DIRTY_POSE);
 }
 
 auto Drawable::SetOrientation(const Quat& quat) -> void {
     m_Pose.orientation = quat;
-    if (m_BackendImpl != nullptr) {
-        m_BackendImpl->SetPose(m_Pose);
-    }
+    _MarkDirty(DIRTY_POSE);
 }
 
 auto Drawable::SetPose(const Pose& pose) -> void {
     m_Pose = pose;
-    if (m_BackendImpl != nullptr) {
-        m_BackendImpl->SetPose(m_Pose);
-    }
+    _MarkDirty(DIRTY_POSE);
 }
 
 auto Drawable::SetColor(const Vec3& color) -> void {
     m_Data.color = color;
-    if (m_BackendImpl != nullptr) {
-        m_BackendImpl->SetColor(m_Data.color);
-    }
+    _MarkDirty(DIRTY_COLOR);
 }
 
 auto Drawable::SetTexture(const std::string& tex_filepath) -> void {
@@ -83,14 +108,10 @@ auto Drawable::ChangeVertexData(size_t num_vertices, const Scalar* ptr_vertices,
     const auto FACES_NUM_ELEMENTS = 3 * num_faces;
     m_Data.mesh_data.n_vertices = num_vertices;
     m_Data.mesh_data.n_faces = num_faces;
-    // NOLINTNEXTLINE
-    m_Data.mesh_data.vertices = std::make_unique<Scalar[]>(VERT_NUM_ELEMENTS);
-    memcpy(m_Data.mesh_data.vertices.get(), ptr_vertices,
-           sizeof(Scalar) * VERT_NUM_ELEMENTS);
-    // NOLINTNEXTLINE
-    m_Data.mesh_data.faces = std::make_unique<uint32_t[]>(FACES_NUM_ELEMENTS);
-    memcpy(m_Data.mesh_data.faces.get(), ptr_faces,
-           sizeof(uint32_t) * FACES_NUM_ELEMENTS);
+    m_Data.mesh_data.vertices =
+        SharedBuffer<Scalar>(ptr_vertices, VERT_NUM_ELEMENTS);
+    m_Data.mesh_data.faces =
+        SharedBuffer<uint32_t>(ptr_faces, FACES_NUM_ELEMENTS);
     // -------------------------------------------------------------------------
     if (m_BackendImpl != nullptr) {
         m_BackendImpl->ChangeVertexData(num_vertices, ptr_vertices, num_faces,
@@ -105,10 +126,8 @@ auto Drawable::ChangeElevationData(size_t n_width_samples,
     const auto GRID_NUM_SCALARS = n_width_samples * n_depth_samples;
     m_Data.hfield_data.n_width_samples = n_width_samples;
     m_Data.hfield_data.n_depth_samples = n_depth_samples;
-    // NOLINTNEXTLINE
-    m_Data.hfield_data.heights = std::make_unique<Scalar[]>(GRID_NUM_SCALARS);
-    memcpy(m_Data.hfield_data.heights.get(), ptr_heights,
-           sizeof(Scalar) * GRID_NUM_SCALARS);
+    m_Data.hfield_data.heights =
+        SharedBuffer<Scalar>(ptr_heights, GRID_NUM_SCALARS);
     // -------------------------------------------------------------------------
     if (m_BackendImpl != nullptr) {
         m_BackendImpl->ChangeElevationData(n_width_samples, n_depth_samples,
@@ -116,6 +135,14 @@ auto Drawable::ChangeElevationData(size_t n_width_samples,
     }
 }
 
+auto Drawable::ChangeElevationRegion(const HeightfieldRegion& region,
+                                     const Scalar* ptr_heights) -> void {
+    WriteElevationRegion(m_Data.hfield_data, region, ptr_heights);
+    if (m_BackendImpl != nullptr) {
+        m_BackendImpl->ChangeElevationRegion(region, ptr_heights);
+    }
+}
+
 auto Drawable::ToString() const -> std::string {
     return fmt::format(
         "<Drawable\n"
@@ -63,6 +63,11 @@ auto Visualizer::Reset() -> void {
 }
 
 auto Visualizer::Update() -> void {
+    LOCO_PROFILE_SCOPE("Visualizer::Update");
+    // Send only what changed since the last update, then let the backend flush
+    if (m_Scenario != nullptr) {
+        m_Scenario->SyncDrawables();
+    }
     if (m_VisualizerImpl != nullptr) {
         m_VisualizerImpl->Update();
     }
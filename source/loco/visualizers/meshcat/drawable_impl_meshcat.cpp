@@ -13,27 +13,35 @@ namespace meshcat {
 
 DrawableImplMeshcat::DrawableImplMeshcat(
     std::string name, ::loco::DrawableData data,
-    std::shared_ptr<MeshcatCpp::Meshcat> handle)
+    std::shared_ptr<MeshcatCpp::Meshcat> handle,
+    PoseBatchMeshcat::ptr pose_batch)
     : m_Data(std::move(data)),
       m_Name(std::move(name)),
-      m_Handle(std::move(handle)) {
+      m_Path("/loco/" + m_Name),
+      m_Handle(std::move(handle)),
+      m_PoseBatch(std::move(pose_batch)) {
     ::loco::meshcat::CreateShape(*m_Handle, m_Name, m_Data);
+    if (m_PoseBatch != nullptr) {
+        m_PoseEntryId = m_PoseBatch->Register(m_Path);
+    }
 }
 
-auto DrawableImplMeshcat::SetPose(const Pose& pose) -> void {
-    Mat4 tf(pose.position, pose.orientation);
-    std::array<double, 16> tf_array = {
-        static_cast<double>(tf(0, 0)), static_cast<double>(tf(1, 0)),
-        static_cast<double>(tf(2, 0)), static_cast<double>(tf(3, 0)),
-        static_cast<double>(tf(0, 1)), static_cast<double>(tf(1, 1)),
-        static_cast<double>(tf(2, 1)), static_cast<double>(tf(3, 1)),
-        static_cast<double>(tf(0, 2)), static_cast<double>(tf(1, 2)),
-        static_cast<double>(tf(2, 2)), static_cast<double>(tf(3, 2)),
-        static_cast<double>(tf(0, 3)), static_cast<double>(tf(1, 3)),
-        static_cast<double>(tf(2, 3)), static_cast<double>(tf(3, 3))};
+DrawableImplMeshcat::~DrawableImplMeshcat() {
+    if (m_PoseBatch != nullptr) {
+        m_PoseBatch->Unregister(m_PoseEntryId);
+    }
+    // Remove the object from the scene, otherwise it stays in the viewer
+    m_Handle->delete_object(m_Path);
+}
 
+auto DrawableImplMeshcat::SetPose(const Pose& pose) -> void {
+    if (m_PoseBatch != nullptr) {
+        m_PoseBatch->SetPose(m_PoseEntryId, pose);
+        return;
+    }
+    auto tf_array = ::loco::meshcat::ToTransform(pose);
     auto mat_view = ::loco::meshcat::ConvertToMatrixView(tf_array);
-    m_Handle->set_transform("/loco/" + m_Name, mat_view);
+    m_Handle->set_transform(m_Path, mat_view);
 }
 
 auto DrawableImplMeshcat::SetColor(const Vec3& color) -> void {}
@@ -52,8 +60,15 @@ auto DrawableImplMeshcat::ChangeElevationData(size_t n_width_samples,
                                               const Scalar* ptr_heights)
     -> void {}
 
+auto DrawableImplMeshcat::ChangeElevationRegion(
+    const HeightfieldRegion& region, const Scalar* ptr_heights) -> void {
+    // Heightfields aren't rendered by this backend yet (see CreateShape), so
+    // only keep our copy of the elevation data up to date
+    ::loco::WriteElevationRegion(m_Data.hfield_data, region, ptr_heights);
+}
+
 auto DrawableImplMeshcat::SetVisible(bool visible) -> void {
-    m_Handle->set_property("/loco/" + m_Name, "visible", visible);
+    m_Handle->set_property(m_Path, "visible", visible);
 }
 
 auto DrawableImplMeshcat::SetWireframe(bool wireframe) -> void {}
@@ -0,0 +1,87 @@
+#include <loco/visualizers/meshcat/pose_batch_meshcat.hpp>
+
+#include <algorithm>
+
+namespace loco {
+namespace meshcat {
+
+auto PoseBatchMeshcat::Register(std::string path) -> size_t {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    size_t entry_id = m_Entries.size();
+    if (!m_FreeEntries.empty()) {
+        entry_id = m_FreeEntries.back();
+        m_FreeEntries.pop_back();
+    } else {
+        m_Entries.emplace_back();
+    }
+    auto& entry = m_Entries[entry_id];
+    entry.path = std::move(path);
+    entry.dirty = false;
+    entry.in_use = true;
+    return entry_id;
+}
+
+auto PoseBatchMeshcat::Unregister(size_t entry_id) -> void {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (entry_id >= m_Entries.size() || !m_Entries[entry_id].in_use) {
+        return;
+    }
+    // Drop its pending pose, so a new entry reusing this id isn't listed twice
+    auto& entry = m_Entries[entry_id];
+    if (entry.dirty) {
+        m_DirtyEntries.erase(std::find(m_DirtyEntries.begin(),
+                                       m_DirtyEntries.end(), entry_id));
+        entry.dirty = false;
+    }
+    entry.in_use = false;
+    m_FreeEntries.push_back(entry_id);
+}
+
+auto PoseBatchMeshcat::SetPose(size_t entry_id, const Pose& pose) -> void {
+    auto transform = ToTransform(pose);
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (entry_id >= m_Entries.size() || !m_Entries[entry_id].in_use) {
+        return;
+    }
+    auto& entry = m_Entries[entry_id];
+    entry.transform = transform;
+    if (!entry.dirty) {
+        entry.dirty = true;
+        m_DirtyEntries.push_back(entry_id);
+    }
+}
+
+auto PoseBatchMeshcat::Flush(MeshcatCpp::Meshcat& handle) -> size_t {
+    LOCO_PROFILE_SCOPE("PoseBatchMeshcat::Flush");
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    size_t num_sent = 0;
+    for (auto entry_id : m_DirtyEntries) {
+        auto& entry = m_Entries[entry_id];
+        entry.dirty = false;
+        auto mat_view = ::loco::meshcat::ConvertToMatrixView(entry.transform);
+        handle.set_transform(entry.path, mat_view);
+        num_sent++;
+    }
+    m_DirtyEntries.clear();
+    return num_sent;
+}
+
+auto PoseBatchMeshcat::num_dirty() const -> size_t {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_DirtyEntries.size();
+}
+
+auto ToTransform(const Pose& pose) -> PoseBatchMeshcat::Transform {
+    Mat4 tf(pose.position, pose.orientation);
+    return {static_cast<double>(tf(0, 0)), static_cast<double>(tf(1, 0)),
+            static_cast<double>(tf(2, 0)), static_cast<double>(tf(3, 0)),
+            static_cast<double>(tf(0, 1)), static_cast<double>(tf(1, 1)),
+            static_cast<double>(tf(2, 1)), static_cast<double>(tf(3, 1)),
+            static_cast<double>(tf(0, 2)), static_cast<double>(tf(1, 2)),
+            static_cast<double>(tf(2, 2)), static_cast<double>(tf(3, 2)),
+            static_cast<double>(tf(0, 3)), static_cast<double>(tf(1, 3)),
+            static_cast<double>(tf(2, 3)), static_cast<double>(tf(3, 3))};
+}
+
+}  // namespace meshcat
+}  // namespace loco
@@ -11,21 +11,32 @@ VisualizerImplMeshcat::VisualizerImplMeshcat(
 
 auto VisualizerImplMeshcat::Init() -> void {
     m_MeshcatInstance = std::make_unique<MeshcatCpp::Meshcat>();
+    m_PoseBatch = std::make_shared<PoseBatchMeshcat>();
 
-    // Collect all free drawables
-    auto num_drawables = m_Scenario->num_drawables();
-    for (size_t i = 0; i < num_drawables; ++i) {
+    // Collect all free drawables (skipping the slots of removed ones)
+    auto num_slots = m_Scenario->num_drawable_slots();
+    for (size_t i = 0; i < num_slots; ++i) {
         auto drawable = m_Scenario->GetDrawableByIndex(i);
+        if (drawable == nullptr) {
+            continue;
+        }
         auto drawable_adapter = std::make_unique<DrawableImplMeshcat>(
-            drawable->name(), drawable->data(), m_MeshcatInstance);
+            drawable->name(), drawable->data(), m_MeshcatInstance,
+            m_PoseBatch);
+        drawable_adapter->SetPose(drawable->pose());
         drawable->SetAdapter(std::move(drawable_adapter));
-        drawable->SetPose(drawable->pose());
     }
+    // Send the initial poses right away, instead of waiting for an update
+    m_PoseBatch->Flush(*m_MeshcatInstance);
 }
 
 auto VisualizerImplMeshcat::Reset() -> void {}
 
-auto VisualizerImplMeshcat::Update() -> void {}
+auto VisualizerImplMeshcat::Update() -> void {
+    if (m_PoseBatch != nullptr && m_MeshcatInstance != nullptr) {
+        m_PoseBatch->Flush(*m_MeshcatInstance);
+    }
+}
 
 }  // namespace meshcat
 }  // namespace loco
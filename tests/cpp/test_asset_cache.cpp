@@ -0,0 +1,207 @@
+#include <catch2/catch.hpp>
+#include <loco/core/asset_cache_t.hpp>
+#include <loco/core/single_body/single_body_collider_t.hpp>
+#include <loco/core/visualizer/drawable_t.hpp>
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace {
+auto CreateMeshData(float scale) -> ::loco::MeshData {
+    const std::vector<float> VERTICES = {0.0F,  0.0F, 0.0F, scale, 0.0F, 0.0F,
+                                         scale, scale, 0.0F, 0.0F, scale, 0.0F};
+    const std::vector<uint32_t> FACES = {0, 1, 2, 0, 2, 3};
+    ::loco::MeshData mesh_data;
+    mesh_data.n_vertices = 4;
+    mesh_data.n_faces = 2;
+    mesh_data.vertices = ::loco::SharedBuffer<Scalar>(4 * 3);
+    for (size_t i = 0; i < VERTICES.size(); ++i) {
+        mesh_data.vertices.mutable_data()[i] =
+            static_cast<Scalar>(VERTICES[i]);
+    }
+    mesh_data.faces = ::loco::SharedBuffer<uint32_t>(FACES.data(), 6);
+    return mesh_data;
+}
+
+auto CreateHeightfieldData(float height) -> ::loco::HeightfieldData {
+    ::loco::HeightfieldData hfield_data;
+    hfield_data.n_width_samples = 4;
+    hfield_data.n_depth_samples = 3;
+    hfield_data.heights = ::loco::SharedBuffer<Scalar>(4 * 3);
+    hfield_data.heights.mutable_data()[5] =
+        static_cast<Scalar>(height);
+    return hfield_data;
+}
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("AssetCache type", "[AssetCache]") {
+    using AssetCache = ::loco::core::AssetCache;
+    AssetCache::Clear();
+
+    SECTION("Identical meshes share the same buffers") {
+        auto mesh_a = CreateMeshData(1.0F);
+        auto mesh_b = CreateMeshData(1.0F);
+        auto mesh_c = CreateMeshData(2.0F);
+        REQUIRE(mesh_a.vertices.get() != mesh_b.vertices.get());
+
+        auto key_a = AssetCache::Share(mesh_a);
+        auto key_b = AssetCache::Share(mesh_b);
+        auto key_c = AssetCache::Share(mesh_c);
+        REQUIRE(key_a != 0);
+        REQUIRE(key_a == key_b);
+        REQUIRE(key_a != key_c);
+        REQUIRE(mesh_a.vertices.get() == mesh_b.vertices.get());
+        REQUIRE(mesh_a.faces.get() == mesh_b.faces.get());
+        REQUIRE(mesh_a.vertices.get() != mesh_c.vertices.get());
+        REQUIRE(AssetCache::num_meshes() == 2);
+
+        // Writing into a shared mesh doesn't affect the others
+        mesh_b.vertices.mutable_data()[0] = 5.0;
+        REQUIRE(mesh_a.vertices[0] == 0.0);
+    }
+
+    SECTION("Identical heightfields share the same buffer") {
+        auto hfield_a = CreateHeightfieldData(0.5F);
+        auto hfield_b = CreateHeightfieldData(0.5F);
+        auto hfield_c = CreateHeightfieldData(0.7F);
+        auto key_a = AssetCache::Share(hfield_a);
+        REQUIRE(AssetCache::Share(hfield_b) == key_a);
+        REQUIRE(AssetCache::Share(hfield_c) != key_a);
+        REQUIRE(hfield_a.heights.get() == hfield_b.heights.get());
+        REQUIRE(hfield_a.heights.get() != hfield_c.heights.get());
+        REQUIRE(AssetCache::num_hfields() == 2);
+    }
+
+    SECTION("Empty assets and primitive shapes aren't cached") {
+        ::loco::MeshData empty_mesh;
+        REQUIRE(AssetCache::Share(empty_mesh) == 0);
+        ::loco::ShapeData box_data;
+        box_data.type = ::loco::eShapeType::BOX;
+        box_data.mesh_data = CreateMeshData(1.0F);
+        REQUIRE(AssetCache::Share(box_data) == 0);
+        REQUIRE(AssetCache::num_meshes() == 0);
+    }
+
+    SECTION("Geometries are created once per asset and type") {
+        auto mesh_data = CreateMeshData(1.0F);
+        auto key = AssetCache::Share(mesh_data);
+        size_t num_created = 0;
+        auto create = [&num_created]() {
+            num_created++;
+            return std::make_shared<int>(42);
+        };
+        auto geom_a = AssetCache::GetOrCreate<int>(key, create);
+        auto geom_b = AssetCache::GetOrCreate<int>(key, create);
+        REQUIRE(num_created == 1);
+        REQUIRE(geom_a == geom_b);
+        REQUIRE(*geom_a == 42);
+
+        auto other = AssetCache::GetOrCreate<double>(
+            key, []() { return std::make_shared<double>(1.0); });
+        REQUIRE(*other == 1.0);
+        REQUIRE(AssetCache::num_geometries() == 2);
+    }
+
+    SECTION("Colliders and drawables built from the same mesh share it") {
+        ::loco::ColliderData col_data;
+        col_data.type = ::loco::eShapeType::TRIANGULAR_MESH;
+        col_data.mesh_data = CreateMeshData(1.0F);
+        col_data.mesh_data.filepath = "mesh.obj";
+        ::loco::DrawableData viz_data;
+        viz_data.type = ::loco::eShapeType::TRIANGULAR_MESH;
+        viz_data.mesh_data = CreateMeshData(1.0F);
+        viz_data.mesh_data.filepath = "mesh.obj";
+
+        auto collider_a = std::make_shared<::loco::core::SingleBodyCollider>(
+            col_data);
+        col_data.mesh_data = CreateMeshData(1.0F);
+        col_data.mesh_data.filepath = "mesh.obj";
+        auto collider_b = std::make_shared<::loco::core::SingleBodyCollider>(
+            col_data);
+        auto drawable = std::make_shared<::loco::core::Drawable>(
+            "mesh", Pose(), viz_data);
+        REQUIRE(collider_a->asset_key() != 0);
+        REQUIRE(collider_a->asset_key() == collider_b->asset_key());
+        REQUIRE(collider_a->data().mesh_data.vertices.get() ==
+                drawable->data().mesh_data.vertices.get());
+        REQUIRE(AssetCache::num_meshes() == 1);
+
+        // Changing the mesh of a collider makes it unique again
+        const auto& mesh_data = collider_b->data().mesh_data;
+        const std::vector<uint32_t> FACES = {0, 2, 1};
+        collider_b->ChangeVertexData(3, mesh_data.vertices.get(), 1,
+                                     FACES.data());
+        REQUIRE(collider_b->asset_key() == 0);
+        REQUIRE(collider_a->data().mesh_data.n_faces == 2);
+    }
+
+    SECTION("Procedural assets aren't shared when creating objects") {
+        ::loco::ColliderData col_data;
+        col_data.type = ::loco::eShapeType::TRIANGULAR_MESH;
+        col_data.mesh_data = CreateMeshData(1.0F);
+        ::loco::core::SingleBodyCollider collider(col_data);
+        ::loco::ColliderData hfield_data;
+        hfield_data.type = ::loco::eShapeType::HEIGHTFIELD;
+        hfield_data.hfield_data = CreateHeightfieldData(0.5F);
+        ::loco::core::SingleBodyCollider hfield_collider(hfield_data);
+        REQUIRE(collider.asset_key() == 0);
+        REQUIRE(hfield_collider.asset_key() == 0);
+        REQUIRE(AssetCache::num_meshes() == 0);
+        REQUIRE(AssetCache::num_hfields() == 0);
+    }
+
+    SECTION("Pruning releases the entries that aren't used anymore") {
+        auto mesh_a = CreateMeshData(1.0F);
+        auto key = AssetCache::Share(mesh_a);
+        {
+            auto mesh_b = CreateMeshData(2.0F);
+            AssetCache::Share(mesh_b);
+            AssetCache::GetOrCreate<int>(
+                key, []() { return std::make_shared<int>(1); });
+        }
+        // The cache only holds weak references, so released assets are gone
+        REQUIRE(AssetCache::num_meshes() == 1);
+        REQUIRE(AssetCache::num_geometries() == 0);
+        REQUIRE(AssetCache::Prune() == 2);
+        REQUIRE(AssetCache::num_meshes() == 1);
+        REQUIRE(AssetCache::num_geometries() == 0);
+    }
+
+    SECTION("Meshes over storage owned by someone else are released") {
+        // E.g. vertices and faces aliasing the same memory-mapped file
+        constexpr size_t NUM_BYTES = 12 * sizeof(Scalar) + 6 * sizeof(uint32_t);
+        auto owner = std::shared_ptr<uint8_t>(new uint8_t[NUM_BYTES],
+                                              std::default_delete<uint8_t[]>());
+        auto reference = CreateMeshData(1.0F);
+        memcpy(owner.get(), reference.vertices.get(), 12 * sizeof(Scalar));
+        memcpy(owner.get() + 12 * sizeof(Scalar), reference.faces.get(),
+               6 * sizeof(uint32_t));
+        ::loco::MeshData mesh_data;
+        mesh_data.n_vertices = 4;
+        mesh_data.n_faces = 2;
+        mesh_data.vertices = ::loco::SharedBuffer<Scalar>(
+            std::shared_ptr<Scalar>(
+                owner, reinterpret_cast<Scalar*>(owner.get())),  // NOLINT
+            12);
+        mesh_data.faces = ::loco::SharedBuffer<uint32_t>(
+            std::shared_ptr<uint32_t>(
+                owner, reinterpret_cast<uint32_t*>(  // NOLINT
+                           owner.get() + 12 * sizeof(Scalar))),
+            6);
+        std::weak_ptr<uint8_t> storage = owner;
+        owner.reset();
+
+        REQUIRE(AssetCache::Share(mesh_data) ==
+                AssetCache::Share(reference));
+        REQUIRE(reference.vertices.get() == mesh_data.vertices.get());
+        mesh_data = ::loco::MeshData();
+        reference = ::loco::MeshData();
+        REQUIRE(storage.expired());
+        REQUIRE(AssetCache::num_meshes() == 0);
+        REQUIRE(AssetCache::Prune() == 1);
+    }
+
+    AssetCache::Clear();
+}
@@ -0,0 +1,129 @@
+#include <catch2/catch.hpp>
+#include <loco/core/scenario_t.hpp>
+#include <loco/core/single_body/body_state_store_t.hpp>
+
+#include <stdexcept>
+
+// NOLINTNEXTLINE
+TEST_CASE("BodyStateStore type", "[BodyStateStore]") {
+    SECTION("Allocated states start at rest, at the origin") {
+        ::loco::core::BodyStateStore store;
+        REQUIRE(store.size() == 0);
+        REQUIRE(store.Allocate() == 0);
+        REQUIRE(store.Allocate() == 1);
+        REQUIRE(store.size() == 2);
+
+        const auto* quats = store.orientations();
+        REQUIRE(quats[4] == Approx(1.0));
+        for (size_t i = 0; i < 2 * 3; ++i) {
+            REQUIRE(store.positions()[i] == Approx(0.0));
+            REQUIRE(store.linear_vels()[i] == Approx(0.0));
+            REQUIRE(store.forces()[i] == Approx(0.0));
+        }
+    }
+
+    SECTION("States are laid out contiguously per field") {
+        ::loco::core::BodyStateStore store;
+        store.Allocate();
+        store.Allocate();
+        store.SetPosition(1, Vec3(1.0, 2.0, 3.0));
+        store.SetForce(0, Vec3(4.0, 5.0, 6.0));
+        REQUIRE(store.positions()[3] == Approx(1.0));
+        REQUIRE(store.positions()[5] == Approx(3.0));
+        REQUIRE(store.GetForce(0).y() == Approx(5.0));
+
+        store.ClearForces();
+        REQUIRE(store.GetForce(0).y() == Approx(0.0));
+    }
+
+    SECTION("The arrays never move, and full stores throw") {
+        ::loco::core::BodyStateStore store(2);
+        REQUIRE(store.capacity() == 2);
+        const auto* positions = store.positions();
+        store.Allocate();
+        store.Allocate();
+        REQUIRE(store.positions() == positions);
+        REQUIRE(store.orientations()[4] == Approx(1.0));
+        REQUIRE_THROWS_AS(store.Allocate(), std::runtime_error);
+        REQUIRE(store.size() == 2);
+    }
+
+    SECTION("Released slots are reset and reused") {
+        ::loco::core::BodyStateStore store(2);
+        store.Allocate();
+        store.Allocate();
+        store.SetPosition(0, Vec3(1.0, 2.0, 3.0));
+        store.SetForce(0, Vec3(4.0, 5.0, 6.0));
+        store.Release(0);
+        REQUIRE(store.size() == 2);
+        REQUIRE(store.num_bodies() == 1);
+        REQUIRE(store.positions()[0] == Approx(0.0));
+        REQUIRE(store.forces()[1] == Approx(0.0));
+        REQUIRE_THROWS_AS(store.Release(0), std::runtime_error);
+        REQUIRE(store.Allocate() == 0);
+        REQUIRE(store.num_bodies() == 2);
+    }
+
+    SECTION("Bodies keep their state inline until moved into a store") {
+        auto store = std::make_shared<::loco::core::BodyStateStore>(2);
+        auto body = std::make_shared<::loco::core::SingleBody>(
+            ::loco::BodyData(), Vec3(1.0, 0.0, 0.0));
+        body->SetLinearVelocity(Vec3(0.0, 2.0, 0.0));
+        body->SetTotalTorque(Vec3(0.0, 0.0, 3.0));
+        REQUIRE(body->state_store() == nullptr);
+        REQUIRE(body->position().x() == Approx(1.0));
+        REQUIRE(body->linear_vel().y() == Approx(2.0));
+
+        body->SetStateStore(store);
+        REQUIRE(body->state_store() == store);
+        REQUIRE(store->num_bodies() == 1);
+        REQUIRE(store->positions()[0] == Approx(1.0));
+        REQUIRE(store->linear_vels()[1] == Approx(2.0));
+        REQUIRE(store->torques()[2] == Approx(3.0));
+    }
+
+    SECTION("Bodies give their slots back when moved or destroyed") {
+        auto store = std::make_shared<::loco::core::BodyStateStore>(2);
+        auto other_store = std::make_shared<::loco::core::BodyStateStore>(2);
+        auto body = std::make_shared<::loco::core::SingleBody>(
+            ::loco::BodyData(), Vec3(1.0, 0.0, 0.0));
+        body->SetStateStore(store);
+        REQUIRE(store->num_bodies() == 1);
+        body->SetStateStore(other_store);
+        REQUIRE(store->num_bodies() == 0);
+        REQUIRE(other_store->num_bodies() == 1);
+        REQUIRE(body->position().x() == Approx(1.0));
+        body = nullptr;
+        REQUIRE(other_store->num_bodies() == 0);
+    }
+
+    SECTION("Bodies added to a scenario share the scenario's store") {
+        auto scenario = std::make_shared<::loco::core::Scenario>();
+        auto body_a = std::make_shared<::loco::core::SingleBody>(
+            ::loco::BodyData(), Vec3(1.0, 0.0, 0.0));
+        auto body_b = std::make_shared<::loco::core::SingleBody>(
+            ::loco::BodyData(), Vec3(0.0, 2.0, 0.0));
+        body_b->SetLinearVelocity(Vec3(0.0, 0.0, 3.0));
+
+        scenario->AddSingleBody(body_a);
+        scenario->AddSingleBody(body_b);
+        REQUIRE(scenario->num_single_bodies() == 2);
+        REQUIRE(scenario->GetSingleBodyByIndex(2) == nullptr);
+
+        auto states = scenario->body_states();
+        REQUIRE(body_a->state_store() == states);
+        REQUIRE(body_b->state_store() == states);
+        REQUIRE(body_b->state_index() == 1);
+        REQUIRE(states->positions()[0] == Approx(1.0));
+        REQUIRE(states->positions()[4] == Approx(2.0));
+        REQUIRE(states->linear_vels()[5] == Approx(3.0));
+
+        body_a->SetPosition(Vec3(0.0, 0.0, 7.0));
+        REQUIRE(states->positions()[2] == Approx(7.0));
+
+        // Writes into the raw arrays are seen by the bodies viewing them
+        states->linear_vels()[3] = 9.0;
+        REQUIRE(body_b->linear_vel().x() == Approx(9.0));
+        REQUIRE_NOTHROW(scenario->PushBodyStates());
+    }
+}
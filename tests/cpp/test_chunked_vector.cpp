@@ -0,0 +1,34 @@
+#include <catch2/catch.hpp>
+#include <loco/core/chunked_vector_t.hpp>
+
+#include <vector>
+
+// NOLINTNEXTLINE
+TEST_CASE("ChunkedVector type", "[ChunkedVector]") {
+    constexpr size_t CHUNK_SIZE = 4;
+    ::loco::core::ChunkedVector<int, CHUNK_SIZE> container;
+    REQUIRE(container.empty());
+    REQUIRE(container.capacity() == 0);
+
+    SECTION("Elements keep their addresses while the container grows") {
+        std::vector<int*> addresses;
+        for (int i = 0; i < 10; ++i) {
+            addresses.push_back(&container.push_back(i));
+        }
+        REQUIRE(container.size() == 10);
+        REQUIRE(container.num_chunks() == 3);
+        REQUIRE(container.capacity() == 3 * CHUNK_SIZE);
+        for (size_t i = 0; i < addresses.size(); ++i) {
+            REQUIRE(&container[i] == addresses[i]);
+            REQUIRE(container[i] == static_cast<int>(i));
+        }
+    }
+
+    SECTION("Reserving allocates whole chunks up front") {
+        container.Reserve(5);
+        REQUIRE(container.num_chunks() == 2);
+        REQUIRE(container.empty());
+        container.Reserve(3);
+        REQUIRE(container.num_chunks() == 2);
+    }
+}
@@ -1,8 +1,28 @@
 #include <catch2/catch.hpp>
 #include <loco/core/common.hpp>
+#include <loco/core/single_body/single_body_collider_t.hpp>
+#include <loco/core/visualizer/drawable_t.hpp>
 
 #include <cmath>
 #include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+// Drawable adapter that records the regions sent to the backend
+class RegionRecorderDrawableImpl : public ::loco::core::DrawableImplNone {
+ public:
+    auto ChangeElevationRegion(const ::loco::HeightfieldRegion& region,
+                               const Scalar* ptr_heights) -> void override {
+        regions.push_back(region);
+        first_heights.push_back(ptr_heights[0]);
+    }
+
+    std::vector<::loco::HeightfieldRegion> regions;
+    std::vector<Scalar> first_heights;
+};
+}  // namespace
 
 // NOLINTNEXTLINE
 TEST_CASE("HfieldData constructors", "[HfieldData]") {
@@ -20,10 +40,11 @@ TEST_CASE("HfieldData constructors", "[HfieldData]") {
         hfield_data_1.n_width_samples = GRID_WIDTH;
         hfield_data_1.n_depth_samples = GRID_DEPTH;
         hfield_data_1.heights =
-            std::make_unique<Scalar[]>(GRID_WIDTH * GRID_DEPTH);  // NOLINT
+            ::loco::SharedBuffer<Scalar>(GRID_WIDTH * GRID_DEPTH);
+        auto* heights = hfield_data_1.heights.mutable_data();
         for (size_t i = 0; i < GRID_DEPTH; ++i) {
             for (size_t j = 0; j < GRID_WIDTH; ++j) {
-                hfield_data_1.heights[j + GRID_WIDTH * i] = ToScalar(i + j);
+                heights[j + GRID_WIDTH * i] = ToScalar(i + j);
             }
         }
         // Make sure copy constructor works as expected
@@ -31,9 +52,9 @@ TEST_CASE("HfieldData constructors", "[HfieldData]") {
         REQUIRE(hfield_data_2.n_width_samples == GRID_WIDTH);
         REQUIRE(hfield_data_2.n_depth_samples == GRID_DEPTH);
         REQUIRE(hfield_data_2.heights != nullptr);
-        REQUIRE(hfield_data_2.heights.get() != hfield_data_1.heights.get());
-        REQUIRE(memcmp(hfield_data_2.heights.get(), hfield_data_1.heights.get(),
-                       sizeof(Scalar) * GRID_WIDTH * GRID_DEPTH) == 0);
+        // The copy shares the elevation buffer (no deep copy)
+        REQUIRE(hfield_data_2.heights.get() == hfield_data_1.heights.get());
+        REQUIRE(hfield_data_2.heights.use_count() == 2);
         // The base from which we copy should still be valid (it's only copied)
         REQUIRE(hfield_data_1.n_width_samples == GRID_WIDTH);
         REQUIRE(hfield_data_1.n_depth_samples == GRID_DEPTH);
@@ -47,11 +68,12 @@ TEST_CASE("HfieldData constructors", "[HfieldData]") {
         hfield_data_1.n_width_samples = GRID_WIDTH;
         hfield_data_1.n_depth_samples = GRID_DEPTH;
         hfield_data_1.heights =
-            std::make_unique<Scalar[]>(GRID_WIDTH * GRID_DEPTH);  // NOLINT
-        hfield_data_1.heights[0] = ToScalar(0.1);
-        hfield_data_1.heights[1] = ToScalar(0.2);
-        hfield_data_1.heights[2] = ToScalar(0.3);
-        hfield_data_1.heights[3] = ToScalar(0.4);
+            ::loco::SharedBuffer<Scalar>(GRID_WIDTH * GRID_DEPTH);
+        auto* heights = hfield_data_1.heights.mutable_data();
+        heights[0] = ToScalar(0.1);
+        heights[1] = ToScalar(0.2);
+        heights[2] = ToScalar(0.3);
+        heights[3] = ToScalar(0.4);
 
         // Make sure the copy assignment operator works as expected
         ::loco::HeightfieldData hfield_data_2;
@@ -59,7 +81,7 @@ TEST_CASE("HfieldData constructors", "[HfieldData]") {
         REQUIRE(hfield_data_2.n_width_samples == GRID_WIDTH);
         REQUIRE(hfield_data_2.n_depth_samples == GRID_DEPTH);
         REQUIRE(hfield_data_2.heights != nullptr);
-        REQUIRE(hfield_data_2.heights.get() != hfield_data_1.heights.get());
+        REQUIRE(hfield_data_2.heights.get() == hfield_data_1.heights.get());
         REQUIRE(hfield_data_2.heights[0] == ToScalar(0.1));
         REQUIRE(hfield_data_2.heights[1] == ToScalar(0.2));
         REQUIRE(hfield_data_2.heights[2] == ToScalar(0.3));
@@ -75,17 +97,17 @@ TEST_CASE("HfieldData constructors", "[HfieldData]") {
         constexpr size_t NEW_GRID_NSAMPLES = NEW_GRID_WIDTH * NEW_GRID_DEPTH;
         hfield_data_1.n_width_samples = NEW_GRID_WIDTH;
         hfield_data_1.n_depth_samples = NEW_GRID_DEPTH;
-        hfield_data_1.heights =
-            std::make_unique<Scalar[]>(NEW_GRID_NSAMPLES);  // NOLINT
-        hfield_data_1.heights[0] = ToScalar(0.5);
-        hfield_data_1.heights[1] = ToScalar(0.6);
-        hfield_data_1.heights[2] = ToScalar(0.7);
-        hfield_data_1.heights[3] = ToScalar(0.8);
-        hfield_data_1.heights[4] = ToScalar(0.9);
-        hfield_data_1.heights[5] = ToScalar(1.0);
-        hfield_data_1.heights[6] = ToScalar(1.1);
-        hfield_data_1.heights[7] = ToScalar(1.2);
-        hfield_data_1.heights[8] = ToScalar(1.3);
+        hfield_data_1.heights = ::loco::SharedBuffer<Scalar>(NEW_GRID_NSAMPLES);
+        heights = hfield_data_1.heights.mutable_data();
+        heights[0] = ToScalar(0.5);
+        heights[1] = ToScalar(0.6);
+        heights[2] = ToScalar(0.7);
+        heights[3] = ToScalar(0.8);
+        heights[4] = ToScalar(0.9);
+        heights[5] = ToScalar(1.0);
+        heights[6] = ToScalar(1.1);
+        heights[7] = ToScalar(1.2);
+        heights[8] = ToScalar(1.3);
         // Checking our base changes as we expected
         REQUIRE(hfield_data_1.n_width_samples == NEW_GRID_WIDTH);
         REQUIRE(hfield_data_1.n_depth_samples == NEW_GRID_DEPTH);
@@ -105,6 +127,13 @@ TEST_CASE("HfieldData constructors", "[HfieldData]") {
         REQUIRE(hfield_data_2.heights[1] == ToScalar(0.2));
         REQUIRE(hfield_data_2.heights[2] == ToScalar(0.3));
         REQUIRE(hfield_data_2.heights[3] == ToScalar(0.4));
+
+        // Writing in place into a shared buffer copies it first
+        ::loco::HeightfieldData hfield_data_3(hfield_data_2);
+        hfield_data_3.heights.mutable_data()[0] = ToScalar(2.0);
+        REQUIRE(hfield_data_3.heights[0] == ToScalar(2.0));
+        REQUIRE(hfield_data_2.heights[0] == ToScalar(0.1));
+        REQUIRE(hfield_data_2.heights.use_count() == 1);
     }
 
     SECTION("Hfield move constructor") {
@@ -114,12 +143,12 @@ TEST_CASE("HfieldData constructors", "[HfieldData]") {
         constexpr size_t GRID_NSAMPLES = GRID_WIDTH * GRID_DEPTH;
         hfield_data_1.n_width_samples = GRID_WIDTH;
         hfield_data_1.n_depth_samples = GRID_DEPTH;
-        hfield_data_1.heights =
-            std::make_unique<Scalar[]>(GRID_NSAMPLES);  // NOLINT
-        hfield_data_1.heights[0] = ToScalar(1.0);
-        hfield_data_1.heights[1] = ToScalar(2.0);
-        hfield_data_1.heights[2] = ToScalar(3.0);
-        hfield_data_1.heights[3] = ToScalar(4.0);
+        hfield_data_1.heights = ::loco::SharedBuffer<Scalar>(GRID_NSAMPLES);
+        auto* heights = hfield_data_1.heights.mutable_data();
+        heights[0] = ToScalar(1.0);
+        heights[1] = ToScalar(2.0);
+        heights[2] = ToScalar(3.0);
+        heights[3] = ToScalar(4.0);
 
         // Make sure the move constructor transfers ownership accordingly
         ::loco::HeightfieldData hfield_data_2(std::move(hfield_data_1));
@@ -144,12 +173,12 @@ TEST_CASE("HfieldData constructors", "[HfieldData]") {
         constexpr size_t GRID_NSAMPLES = GRID_WIDTH * GRID_DEPTH;
         hfield_data_1.n_width_samples = GRID_WIDTH;
         hfield_data_1.n_depth_samples = GRID_DEPTH;
-        hfield_data_1.heights =
-            std::make_unique<Scalar[]>(GRID_NSAMPLES);  // NOLINT
-        hfield_data_1.heights[0] = ToScalar(1.0);
-        hfield_data_1.heights[1] = ToScalar(2.0);
-        hfield_data_1.heights[2] = ToScalar(3.0);
-        hfield_data_1.heights[3] = ToScalar(4.0);
+        hfield_data_1.heights = ::loco::SharedBuffer<Scalar>(GRID_NSAMPLES);
+        auto* heights = hfield_data_1.heights.mutable_data();
+        heights[0] = ToScalar(1.0);
+        heights[1] = ToScalar(2.0);
+        heights[2] = ToScalar(3.0);
+        heights[3] = ToScalar(4.0);
 
         // Make sure the move assignment operator transfers ownership
         ::loco::HeightfieldData hfield_data_2;
@@ -168,3 +197,98 @@ TEST_CASE("HfieldData constructors", "[HfieldData]") {
         REQUIRE(hfield_data_1.heights == nullptr);
     }
 }
+
+// NOLINTNEXTLINE
+TEST_CASE("HfieldData region updates", "[HfieldData]") {
+    constexpr size_t GRID_WIDTH = 8;
+    constexpr size_t GRID_DEPTH = 6;
+    ::loco::HeightfieldData hfield_data;
+    hfield_data.n_width_samples = GRID_WIDTH;
+    hfield_data.n_depth_samples = GRID_DEPTH;
+    hfield_data.heights = ::loco::SharedBuffer<Scalar>(GRID_WIDTH * GRID_DEPTH);
+
+    // A 3x2 region (3 samples per row, 2 rows) starting at sample (4, 1)
+    ::loco::HeightfieldRegion region;
+    region.width_start = 4;
+    region.depth_start = 1;
+    region.n_width_samples = 3;
+    region.n_depth_samples = 2;
+    const std::vector<Scalar> REGION_HEIGHTS = {ToScalar(1.0), ToScalar(2.0),
+                                                ToScalar(3.0), ToScalar(4.0),
+                                                ToScalar(5.0), ToScalar(6.0)};
+
+    SECTION("Only the samples of the region are written") {
+        ::loco::WriteElevationRegion(hfield_data, region,
+                                     REGION_HEIGHTS.data());
+        for (size_t i = 0; i < GRID_DEPTH; ++i) {
+            for (size_t j = 0; j < GRID_WIDTH; ++j) {
+                auto expected = ToScalar(0.0);
+                if (i >= 1 && i < 3 && j >= 4 && j < 7) {
+                    expected = REGION_HEIGHTS[(j - 4) + 3 * (i - 1)];
+                }
+                REQUIRE(hfield_data.heights[j + GRID_WIDTH * i] == expected);
+            }
+        }
+    }
+
+    SECTION("Shared elevation data is copied before writing a region") {
+        auto hfield_data_copy = hfield_data;
+        ::loco::WriteElevationRegion(hfield_data, region,
+                                     REGION_HEIGHTS.data());
+        REQUIRE(hfield_data.heights.get() != hfield_data_copy.heights.get());
+        REQUIRE(hfield_data_copy.heights[4 + GRID_WIDTH] == ToScalar(0.0));
+        REQUIRE(hfield_data.heights[4 + GRID_WIDTH] == ToScalar(1.0));
+    }
+
+    SECTION("Regions out of bounds throw") {
+        region.width_start = 6;
+        REQUIRE_THROWS_AS(::loco::WriteElevationRegion(hfield_data, region,
+                                                       REGION_HEIGHTS.data()),
+                          std::runtime_error);
+    }
+
+    SECTION("Heightfields without elevation data get zeroed storage") {
+        hfield_data.heights = nullptr;
+        ::loco::WriteElevationRegion(hfield_data, region,
+                                     REGION_HEIGHTS.data());
+        REQUIRE(hfield_data.heights.size() == GRID_WIDTH * GRID_DEPTH);
+        REQUIRE(hfield_data.heights[0] == ToScalar(0.0));
+        REQUIRE(hfield_data.heights[4 + GRID_WIDTH] == ToScalar(1.0));
+        REQUIRE(hfield_data.heights[6 + 2 * GRID_WIDTH] == ToScalar(6.0));
+    }
+
+    SECTION("Drawables send only the region to their backend") {
+        ::loco::DrawableData viz_data;
+        viz_data.type = ::loco::eShapeType::HEIGHTFIELD;
+        viz_data.hfield_data = hfield_data;
+        ::loco::core::Drawable drawable("terrain", Pose(), viz_data);
+        auto adapter = std::make_unique<RegionRecorderDrawableImpl>();
+        auto* recorder = adapter.get();
+        drawable.SetAdapter(std::move(adapter));
+
+        drawable.ChangeElevationRegion(region, REGION_HEIGHTS.data());
+        REQUIRE(recorder->regions.size() == 1);
+        REQUIRE(recorder->regions[0].width_start == 4);
+        REQUIRE(recorder->regions[0].n_depth_samples == 2);
+        REQUIRE(recorder->first_heights[0] == ToScalar(1.0));
+        REQUIRE(drawable.data().hfield_data.heights[4 + GRID_WIDTH] ==
+                ToScalar(1.0));
+    }
+
+    SECTION("Colliders keep the region, and leave the original data intact") {
+        ::loco::ColliderData col_data;
+        col_data.type = ::loco::eShapeType::HEIGHTFIELD;
+        col_data.hfield_data = hfield_data;
+        ::loco::core::SingleBodyCollider collider(col_data);
+        // Procedural heightfields aren't shared through the AssetCache
+        REQUIRE(collider.asset_key() == 0);
+        REQUIRE(collider.data().hfield_data.heights.get() ==
+                hfield_data.heights.get());
+
+        collider.ChangeElevationRegion(region, REGION_HEIGHTS.data());
+        REQUIRE(collider.data().hfield_data.heights[4 + GRID_WIDTH] ==
+                ToScalar(1.0));
+        REQUIRE(collider.asset_key() == 0);
+        REQUIRE(hfield_data.heights[4 + GRID_WIDTH] == ToScalar(0.0));
+    }
+}
@@ -18,34 +18,35 @@ auto create_test_mesh(::loco::MeshData& mesh_data) -> void {
     // p0(-1, -1, 0) *-------* p1(1, -1, 0)
     mesh_data.filepath = FILEPATH;
     mesh_data.n_vertices = NUM_VERTICES;
-    mesh_data.vertices =
-        std::make_unique<Scalar[]>(3 * NUM_VERTICES);  // NOLINT
+    mesh_data.vertices = ::loco::SharedBuffer<Scalar>(3 * NUM_VERTICES);
+    auto* vertices = mesh_data.vertices.mutable_data();
     // vertex p0 = (-1.0, -1.0, 0.0)
-    mesh_data.vertices[0] = ToScalar(-1.0);
-    mesh_data.vertices[1] = ToScalar(-1.0);
-    mesh_data.vertices[2] = ToScalar(0.0);
+    vertices[0] = ToScalar(-1.0);
+    vertices[1] = ToScalar(-1.0);
+    vertices[2] = ToScalar(0.0);
     // vertex p1 = (1.0, -1.0, 0.0)
-    mesh_data.vertices[3] = ToScalar(1.0);
-    mesh_data.vertices[4] = ToScalar(-1.0);
-    mesh_data.vertices[5] = ToScalar(0.0);
+    vertices[3] = ToScalar(1.0);
+    vertices[4] = ToScalar(-1.0);
+    vertices[5] = ToScalar(0.0);
     // vertex p2 = (1.0, 1.0, 0.0)
-    mesh_data.vertices[6] = ToScalar(1.0);
-    mesh_data.vertices[7] = ToScalar(1.0);
-    mesh_data.vertices[8] = ToScalar(0.0);
+    vertices[6] = ToScalar(1.0);
+    vertices[7] = ToScalar(1.0);
+    vertices[8] = ToScalar(0.0);
     // vertex p3 = (1.0, 1.0, 0.0)
-    mesh_data.vertices[9] = ToScalar(-1.0);
-    mesh_data.vertices[10] = ToScalar(1.0);
-    mesh_data.vertices[11] = ToScalar(0.0);
+    vertices[9] = ToScalar(-1.0);
+    vertices[10] = ToScalar(1.0);
+    vertices[11] = ToScalar(0.0);
     mesh_data.n_faces = NUM_FACES;
-    mesh_data.faces = std::make_unique<uint32_t[]>(3 * NUM_FACES);  // NOLINT
+    mesh_data.faces = ::loco::SharedBuffer<uint32_t>(3 * NUM_FACES);
+    auto* faces = mesh_data.faces.mutable_data();
     // triangle p0-p1-p2
-    mesh_data.faces[0] = 0;
-    mesh_data.faces[1] = 1;
-    mesh_data.faces[2] = 2;
+    faces[0] = 0;
+    faces[1] = 1;
+    faces[2] = 2;
     // triangle p0-p2-p3
-    mesh_data.faces[3] = 0;
-    mesh_data.faces[4] = 2;
-    mesh_data.faces[5] = 3;
+    faces[3] = 0;
+    faces[4] = 2;
+    faces[5] = 3;
 }
 
 // NOLINTNEXTLINE
@@ -104,14 +105,13 @@ TEST_CASE("MeshData constructors", "[MeshData]") {
         REQUIRE(mesh_data_1.filepath == FILEPATH);
         REQUIRE(mesh_data_1.n_vertices == NUM_VERTICES);
         REQUIRE(mesh_data_1.vertices != nullptr);
-        REQUIRE(mesh_data_1.vertices.get() != mesh_data_2.vertices.get());
-        REQUIRE(memcmp(mesh_data_1.vertices.get(), mesh_data_2.vertices.get(),
-                       sizeof(Scalar) * NUM_VERTICES * 3) == 0);
         REQUIRE(mesh_data_1.n_faces == NUM_FACES);
         REQUIRE(mesh_data_1.faces != nullptr);
-        REQUIRE(mesh_data_1.faces.get() != mesh_data_2.faces.get());
-        REQUIRE(memcmp(mesh_data_1.faces.get(), mesh_data_2.faces.get(),
-                       sizeof(uint32_t) * NUM_FACES * 3) == 0);
+
+        // Both copies share the same buffers (no deep copy)
+        REQUIRE(mesh_data_1.vertices.get() == mesh_data_2.vertices.get());
+        REQUIRE(mesh_data_1.faces.get() == mesh_data_2.faces.get());
+        REQUIRE(mesh_data_1.vertices.use_count() == 2);
     }
 
     // This test should be quite similar to the previous one; the only thing
@@ -129,14 +129,13 @@ TEST_CASE("MeshData constructors", "[MeshData]") {
         REQUIRE(mesh_data_1.filepath == FILEPATH);
         REQUIRE(mesh_data_1.n_vertices == NUM_VERTICES);
         REQUIRE(mesh_data_1.vertices != nullptr);
-        REQUIRE(mesh_data_1.vertices.get() != mesh_data_2.vertices.get());
-        REQUIRE(memcmp(mesh_data_1.vertices.get(), mesh_data_2.vertices.get(),
-                       sizeof(Scalar) * NUM_VERTICES * 3) == 0);
         REQUIRE(mesh_data_1.n_faces == NUM_FACES);
         REQUIRE(mesh_data_1.faces != nullptr);
-        REQUIRE(mesh_data_1.faces.get() != mesh_data_2.faces.get());
-        REQUIRE(memcmp(mesh_data_1.faces.get(), mesh_data_2.faces.get(),
-                       sizeof(uint32_t) * NUM_FACES * 3) == 0);
+
+        // Both copies share the same buffers (no deep copy)
+        REQUIRE(mesh_data_1.vertices.get() == mesh_data_2.vertices.get());
+        REQUIRE(mesh_data_1.faces.get() == mesh_data_2.faces.get());
+        REQUIRE(mesh_data_1.vertices.use_count() == 2);
     }
 
     SECTION("MeshData move constructor") {
@@ -172,3 +171,40 @@ TEST_CASE("MeshData constructors", "[MeshData]") {
         REQUIRE(mesh_data_1.faces == nullptr);
     }
 }
+
+// NOLINTNEXTLINE
+TEST_CASE("MeshData shared buffers", "[MeshData]") {
+    ::loco::MeshData mesh_data_1;
+    create_test_mesh(mesh_data_1);
+    ::loco::MeshData mesh_data_2(mesh_data_1);
+
+    SECTION("Writing into a copy doesn't affect the other copies") {
+        auto* vertices = mesh_data_2.vertices.mutable_data();
+        vertices[0] = ToScalar(10.0);
+        REQUIRE(mesh_data_1.vertices.get() != mesh_data_2.vertices.get());
+        REQUIRE(mesh_data_1.vertices.use_count() == 1);
+        REQUIRE(mesh_data_2.vertices[0] == ToScalar(10.0));
+        REQUIRE(mesh_data_2.vertices[1] == ToScalar(-1.0));
+        validate_test_mesh(mesh_data_1);
+        // The faces weren't written, so they're still shared
+        REQUIRE(mesh_data_1.faces.get() == mesh_data_2.faces.get());
+    }
+
+    SECTION("Writing into a buffer that isn't shared doesn't copy it") {
+        ::loco::MeshData mesh_data_3(std::move(mesh_data_2));
+        const auto* faces = mesh_data_1.faces.get();
+        REQUIRE(mesh_data_1.faces.mutable_data() != faces);
+        REQUIRE(mesh_data_3.faces.mutable_data() == faces);
+    }
+
+    SECTION("Moved-from buffers are left empty") {
+        auto vertices = std::move(mesh_data_2.vertices);
+        REQUIRE(vertices.size() == 3 * mesh_data_1.n_vertices);
+        REQUIRE(mesh_data_2.vertices == nullptr);
+        REQUIRE(mesh_data_2.vertices.size() == 0);
+        mesh_data_2.vertices = std::move(vertices);
+        REQUIRE(mesh_data_2.vertices.size() == 3 * mesh_data_1.n_vertices);
+        REQUIRE(vertices == nullptr);
+        REQUIRE(vertices.size() == 0);
+    }
+}
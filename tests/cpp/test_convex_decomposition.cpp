@@ -0,0 +1,268 @@
+#include <catch2/catch.hpp>
+#include <loco/core/convex_decomposition_t.hpp>
+
+#include <array>
+#include <cmath>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace {
+using Voxel = std::array<int, 3>;
+
+auto CreateMeshData(const std::vector<Scalar>& vertices,
+                    const std::vector<uint32_t>& faces) -> ::loco::MeshData {
+    ::loco::MeshData mesh_data;
+    mesh_data.n_vertices = vertices.size() / 3;
+    mesh_data.n_faces = faces.size() / 3;
+    mesh_data.vertices =
+        ::loco::SharedBuffer<Scalar>(vertices.data(), vertices.size());
+    mesh_data.faces =
+        ::loco::SharedBuffer<uint32_t>(faces.data(), faces.size());
+    return mesh_data;
+}
+
+// Builds the closed surface of the given set of unit voxels
+auto CreateVoxelMesh(const std::set<Voxel>& voxels) -> ::loco::MeshData {
+    std::vector<Scalar> vertices;
+    std::vector<uint32_t> faces;
+    std::map<Voxel, uint32_t> vertex_ids;
+    auto vertex_id = [&](const Voxel& corner) {
+        auto it = vertex_ids.find(corner);
+        if (it == vertex_ids.end()) {
+            auto id = static_cast<uint32_t>(vertices.size() / 3);
+            it = vertex_ids.emplace(corner, id).first;
+            for (auto coord : corner) {
+                vertices.push_back(static_cast<Scalar>(coord));
+            }
+        }
+        return it->second;
+    };
+    for (const auto& voxel : voxels) {
+        for (int axis = 0; axis < 3; ++axis) {
+            for (int dir = -1; dir <= 1; dir += 2) {
+                auto neighbor = voxel;
+                neighbor[axis] += dir;
+                if (voxels.count(neighbor) > 0) {
+                    continue;
+                }
+                // Corners of the quad, counter-clockwise seen from outside
+                const int U = (axis + 1) % 3;
+                const int V = (axis + 2) % 3;
+                std::array<Voxel, 4> quad;
+                const std::array<std::pair<int, int>, 4> UV = {
+                    {{0, 0}, {1, 0}, {1, 1}, {0, 1}}};
+                for (size_t c = 0; c < 4; ++c) {
+                    auto corner = voxel;
+                    corner[axis] += (dir > 0) ? 1 : 0;
+                    corner[U] += (dir > 0) ? UV[c].first : UV[c].second;
+                    corner[V] += (dir > 0) ? UV[c].second : UV[c].first;
+                    quad[c] = corner;
+                }
+                faces.insert(faces.end(),
+                             {vertex_id(quad[0]), vertex_id(quad[1]),
+                              vertex_id(quad[2]), vertex_id(quad[0]),
+                              vertex_id(quad[2]), vertex_id(quad[3])});
+            }
+        }
+    }
+    return CreateMeshData(vertices, faces);
+}
+
+// Checks that the mesh is closed, and that all vertices lie behind all faces
+auto IsConvexHull(const ::loco::MeshData& hull) -> bool {
+    if (hull.n_faces == 0) {
+        return false;
+    }
+    std::set<std::pair<uint32_t, uint32_t>> edges;
+    for (size_t f = 0; f < hull.n_faces; ++f) {
+        const auto* tri = hull.faces.get() + 3 * f;
+        const auto* a = hull.vertices.get() + 3 * tri[0];
+        const auto* b = hull.vertices.get() + 3 * tri[1];
+        const auto* c = hull.vertices.get() + 3 * tri[2];
+        const double AB[] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+        const double AC[] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+        const double N[] = {AB[1] * AC[2] - AB[2] * AC[1],
+                            AB[2] * AC[0] - AB[0] * AC[2],
+                            AB[0] * AC[1] - AB[1] * AC[0]};
+        for (size_t v = 0; v < hull.n_vertices; ++v) {
+            const auto* p = hull.vertices.get() + 3 * v;
+            auto dist = N[0] * (p[0] - a[0]) + N[1] * (p[1] - a[1]) +
+                        N[2] * (p[2] - a[2]);
+            if (dist > 1e-4) {
+                return false;
+            }
+        }
+        for (size_t e = 0; e < 3; ++e) {
+            edges.emplace(tri[e], tri[(e + 1) % 3]);
+        }
+    }
+    for (const auto& edge : edges) {
+        if (edges.count({edge.second, edge.first}) == 0) {
+            return false;
+        }
+    }
+    // Euler characteristic of a closed convex polyhedron: V - E + F = 2
+    return static_cast<long>(hull.n_vertices) -
+               static_cast<long>(edges.size() / 2) +
+               static_cast<long>(hull.n_faces) ==
+           2;
+}
+
+// Volume enclosed by the given closed mesh (faces counter-clockwise)
+auto HullVolume(const ::loco::MeshData& hull) -> double {
+    double volume = 0.0;
+    for (size_t f = 0; f < hull.n_faces; ++f) {
+        const auto* tri = hull.faces.get() + 3 * f;
+        const auto* a = hull.vertices.get() + 3 * tri[0];
+        const auto* b = hull.vertices.get() + 3 * tri[1];
+        const auto* c = hull.vertices.get() + 3 * tri[2];
+        // Signed volume of the tetrahedron (origin, a, b, c), times 6
+        volume += a[0] * (b[1] * c[2] - b[2] * c[1]) +
+                  a[1] * (b[2] * c[0] - b[0] * c[2]) +
+                  a[2] * (b[0] * c[1] - b[1] * c[0]);
+    }
+    return volume / 6.0;
+}
+
+// Points evenly spread over the unit sphere (all of them are hull vertices)
+auto CreateSpherePoints(size_t num_points) -> ::loco::MeshData {
+    std::vector<Scalar> vertices;
+    const double GOLDEN_ANGLE = M_PI * (3.0 - std::sqrt(5.0));
+    for (size_t i = 0; i < num_points; ++i) {
+        auto z = 1.0 - 2.0 * (static_cast<double>(i) + 0.5) /
+                           static_cast<double>(num_points);
+        auto radius = std::sqrt(1.0 - z * z);
+        auto theta = GOLDEN_ANGLE * static_cast<double>(i);
+        vertices.push_back(static_cast<Scalar>(radius * std::cos(theta)));
+        vertices.push_back(static_cast<Scalar>(radius * std::sin(theta)));
+        vertices.push_back(static_cast<Scalar>(z));
+    }
+    return CreateMeshData(vertices, {});
+}
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("ConvexDecomposition hulls", "[ConvexDecomposition]") {
+    using ConvexDecomposition = ::loco::core::ConvexDecomposition;
+
+    SECTION("Interior points are discarded") {
+        std::vector<Scalar> vertices;
+        for (int i = 0; i < 8; ++i) {
+            vertices.push_back(static_cast<Scalar>(i & 1));
+            vertices.push_back(static_cast<Scalar>((i >> 1) & 1));
+            vertices.push_back(static_cast<Scalar>((i >> 2) & 1));
+        }
+        for (int i = 1; i < 10; ++i) {
+            vertices.push_back(static_cast<Scalar>(0.1 * i));
+            vertices.push_back(static_cast<Scalar>(0.5));
+            vertices.push_back(static_cast<Scalar>(1.0 - 0.1 * i));
+        }
+        auto hull = ConvexDecomposition::ComputeHull(
+            CreateMeshData(vertices, {}));
+        REQUIRE(hull.n_vertices == 8);
+        REQUIRE(hull.n_faces == 12);
+        REQUIRE(IsConvexHull(hull));
+    }
+
+    SECTION("Vertex limits keep the most significant points") {
+        auto points = CreateSpherePoints(200);
+        auto full_hull = ConvexDecomposition::ComputeHull(points);
+        REQUIRE(full_hull.n_vertices == 200);
+        REQUIRE(IsConvexHull(full_hull));
+
+        auto limited_hull = ConvexDecomposition::ComputeHull(points, 20);
+        REQUIRE(limited_hull.n_vertices == 20);
+        REQUIRE(IsConvexHull(limited_hull));
+        // Adding the point farthest from the hull first keeps most of the
+        // volume (picking the farthest point of an arbitrary face keeps ~65%)
+        REQUIRE(HullVolume(full_hull) ==
+                Approx(4.0 / 3.0 * M_PI).epsilon(0.05));
+        REQUIRE(HullVolume(limited_hull) / HullVolume(full_hull) > 0.7);
+    }
+
+    SECTION("Coplanar points have no hull faces") {
+        const std::vector<Scalar> VERTICES = {0, 0, 0, 1, 0, 0, 1, 1, 0,
+                                              0, 1, 0, 0.5, 0.5, 0};
+        auto hull = ConvexDecomposition::ComputeHull(
+            CreateMeshData(VERTICES, {}));
+        REQUIRE(hull.n_vertices == 5);
+        REQUIRE(hull.n_faces == 0);
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_CASE("ConvexDecomposition decompositions", "[ConvexDecomposition]") {
+    using ConvexDecomposition = ::loco::core::ConvexDecomposition;
+    auto box_mesh = CreateVoxelMesh({{0, 0, 0}, {1, 0, 0}, {0, 1, 0},
+                                     {1, 1, 0}});
+    auto l_mesh = CreateVoxelMesh({{0, 0, 0}, {1, 0, 0}, {2, 0, 0},
+                                   {0, 1, 0}, {0, 2, 0}});
+
+    SECTION("Convex meshes are kept in a single piece") {
+        auto hulls = ConvexDecomposition::Decompose(box_mesh);
+        REQUIRE(hulls.size() == 1);
+        REQUIRE(hulls[0].n_vertices == 8);
+        REQUIRE(IsConvexHull(hulls[0]));
+    }
+
+    SECTION("Concave meshes are split into convex pieces") {
+        auto hulls = ConvexDecomposition::Decompose(l_mesh);
+        REQUIRE(hulls.size() >= 2);
+        for (const auto& hull : hulls) {
+            REQUIRE(IsConvexHull(hull));
+        }
+
+        ::loco::core::ConvexDecompositionParams params;
+        params.max_hulls = 2;
+        params.max_vertices_per_hull = 6;
+        hulls = ConvexDecomposition::Decompose(l_mesh, params);
+        REQUIRE(hulls.size() == 2);
+        for (const auto& hull : hulls) {
+            REQUIRE(hull.n_vertices <= 6);
+            REQUIRE(IsConvexHull(hull));
+        }
+    }
+
+    SECTION("Mesh colliders are converted into convex colliders") {
+        ::loco::ColliderData col_data;
+        col_data.type = ::loco::eShapeType::TRIANGULAR_MESH;
+        col_data.size = {2.0, 2.0, 2.0};
+        col_data.collision_group = 3;
+        col_data.mesh_data = l_mesh;
+        auto compound = ConvexDecomposition::MakeConvexCollider(col_data);
+        REQUIRE(compound.type == ::loco::eShapeType::COMPOUND);
+        REQUIRE(compound.children.size() >= 2);
+        for (const auto& child : compound.children) {
+            REQUIRE(child.type == ::loco::eShapeType::CONVEX_MESH);
+            REQUIRE(child.size.x() == Approx(2.0));
+            REQUIRE(child.collision_group == 3);
+        }
+
+        col_data.mesh_data = box_mesh;
+        auto convex = ConvexDecomposition::MakeConvexCollider(col_data);
+        REQUIRE(convex.type == ::loco::eShapeType::CONVEX_MESH);
+        REQUIRE(convex.children.empty());
+        REQUIRE(convex.mesh_data.n_faces == 12);
+
+        col_data.type = ::loco::eShapeType::BOX;
+        REQUIRE_THROWS_AS(ConvexDecomposition::MakeConvexCollider(col_data),
+                          std::runtime_error);
+    }
+
+    SECTION("Faces using missing vertices throw") {
+        auto bad_mesh = CreateMeshData(
+            {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0},
+            {0, 2, 1, 0, 1, 5});
+        REQUIRE_THROWS_AS(ConvexDecomposition::Decompose(bad_mesh),
+                          std::runtime_error);
+
+        ::loco::ColliderData col_data;
+        col_data.type = ::loco::eShapeType::TRIANGULAR_MESH;
+        col_data.mesh_data = bad_mesh;
+        REQUIRE_THROWS_AS(ConvexDecomposition::MakeConvexCollider(col_data),
+                          std::runtime_error);
+    }
+}
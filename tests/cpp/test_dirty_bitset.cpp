@@ -0,0 +1,38 @@
+#include <catch2/catch.hpp>
+#include <loco/core/dirty_bitset_t.hpp>
+
+#include <vector>
+
+// NOLINTNEXTLINE
+TEST_CASE("DirtyBitset type", "[DirtyBitset]") {
+    ::loco::core::DirtyBitset dirty_set;
+    REQUIRE(dirty_set.size() == 0);
+    REQUIRE(dirty_set.count() == 0);
+
+    dirty_set.Resize(200);
+    REQUIRE(dirty_set.size() == 200);
+
+    SECTION("Marked bits are visited once, in order, and then cleared") {
+        dirty_set.Set(3);
+        dirty_set.Set(130);
+        dirty_set.Set(3);
+        dirty_set.Set(64);
+        dirty_set.Set(500);  // out of range, ignored
+        REQUIRE(dirty_set.count() == 3);
+        REQUIRE(dirty_set.Test(64));
+        REQUIRE_FALSE(dirty_set.Test(65));
+
+        std::vector<size_t> visited;
+        dirty_set.Consume([&](size_t index) { visited.push_back(index); });
+        REQUIRE(visited == std::vector<size_t>{3, 64, 130});
+        REQUIRE(dirty_set.count() == 0);
+    }
+
+    SECTION("Growing keeps the bits already marked") {
+        dirty_set.Set(199);
+        dirty_set.Resize(10000);
+        REQUIRE(dirty_set.Test(199));
+        dirty_set.Set(9999);
+        REQUIRE(dirty_set.count() == 2);
+    }
+}
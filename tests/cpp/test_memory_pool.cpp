@@ -0,0 +1,83 @@
+#include <catch2/catch.hpp>
+#include <loco/core/memory_pool_t.hpp>
+#include <loco/core/visualizer/drawable_primitives.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
+
+// NOLINTNEXTLINE
+TEST_CASE("MemoryPool type", "[MemoryPool]") {
+    constexpr size_t BLOCK_SIZE = 40;
+    constexpr size_t BLOCKS_PER_CHUNK = 8;
+    ::loco::core::MemoryPool pool(BLOCK_SIZE, BLOCKS_PER_CHUNK);
+    REQUIRE(pool.block_size() >= BLOCK_SIZE);
+    REQUIRE(pool.block_size() % alignof(std::max_align_t) == 0);
+    REQUIRE(pool.num_chunks() == 0);
+
+    SECTION("Blocks are distinct, aligned, and grow the pool by chunks") {
+        std::set<void*> blocks;
+        for (size_t i = 0; i < 2 * BLOCKS_PER_CHUNK + 1; ++i) {
+            auto* block = pool.Allocate();
+            REQUIRE(reinterpret_cast<uintptr_t>(block) %
+                        alignof(std::max_align_t) ==
+                    0);
+            blocks.insert(block);
+        }
+        REQUIRE(blocks.size() == 2 * BLOCKS_PER_CHUNK + 1);
+        REQUIRE(pool.num_chunks() == 3);
+        REQUIRE(pool.num_allocated() == blocks.size());
+        for (auto* block : blocks) {
+            pool.Deallocate(block);
+        }
+        REQUIRE(pool.num_allocated() == 0);
+    }
+
+    SECTION("Freed blocks are reused before growing the pool") {
+        auto* block = pool.Allocate();
+        pool.Deallocate(block);
+        REQUIRE(pool.Allocate() == block);
+        REQUIRE(pool.num_chunks() == 1);
+        pool.Deallocate(block);
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_CASE("Pooled drawables", "[MemoryPool]") {
+    using SmallObjectAllocator = ::loco::core::SmallObjectAllocator;
+    // Totals of blocks in use and chunks, over all the size classes
+    auto count_pooled = []() -> std::pair<size_t, size_t> {
+        size_t num_allocated = 0;
+        size_t num_chunks = 0;
+        for (size_t size = SmallObjectAllocator::MIN_POOLED_SIZE;
+             size <= SmallObjectAllocator::MAX_POOLED_SIZE; size <<= 1U) {
+            num_allocated += SmallObjectAllocator::num_allocated(size);
+            num_chunks += SmallObjectAllocator::num_chunks(size);
+        }
+        return {num_allocated, num_chunks};
+    };
+
+    constexpr size_t NUM_MARKERS = 1000;
+    std::vector<::loco::core::viz::Sphere::ptr> markers;
+    for (size_t i = 0; i < NUM_MARKERS; ++i) {
+        markers.push_back(::loco::core::MakePooled<::loco::core::viz::Sphere>(
+            "marker", Vec3(0.0, 0.0, static_cast<Scalar>(i)), 0.01F));
+    }
+    REQUIRE(markers.back()->position().z() == Approx(NUM_MARKERS - 1));
+    const auto POOLED_BEFORE = count_pooled();
+    REQUIRE(POOLED_BEFORE.first >= NUM_MARKERS);
+
+    // Releasing and creating the markers again shouldn't need more blocks
+    markers.clear();
+    REQUIRE(count_pooled().first < POOLED_BEFORE.first);
+    for (size_t i = 0; i < NUM_MARKERS; ++i) {
+        markers.push_back(::loco::core::MakePooled<::loco::core::viz::Sphere>(
+            "marker", Vec3(0.0, 0.0, 0.0), 0.01F));
+    }
+    REQUIRE(markers.size() == NUM_MARKERS);
+    const auto POOLED_AFTER = count_pooled();
+    REQUIRE(POOLED_AFTER.first == POOLED_BEFORE.first);
+    REQUIRE(POOLED_AFTER.second == POOLED_BEFORE.second);
+}
@@ -0,0 +1,234 @@
+#include <catch2/catch.hpp>
+#include <loco/core/mesh_loader_t.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+namespace {
+// A unit square made of a single quad (triangulated into 2 faces)
+constexpr const char* SQUARE_OBJ =
+    "# unit square\n"
+    "v 0.0 0.0 0.0\n"
+    "v 1.0 0.0 0.0\n"
+    "v 1.0 1.0 0.0\n"
+    "v 0.0 1.0 0.0\n"
+    "vn 0.0 0.0 1.0\n"
+    "f 1//1 2//1 3//1 4//1\n";
+
+// The same square, with an extra triangle using relative indices
+constexpr const char* SQUARE_OBJ_EXTENDED =
+    "v 0.0 0.0 0.0\n"
+    "v 1.0 0.0 0.0\n"
+    "v 1.0 1.0 0.0\n"
+    "v 0.0 1.0 0.0\n"
+    "f 1 2 3 4\n"
+    "v 2.0 0.0 0.0\n"
+    "f -4 -1 -3\n";
+
+// The same square as 2 triangles in an ASCII STL (corners are repeated)
+constexpr const char* SQUARE_STL =
+    "solid square\n"
+    "facet normal 0 0 1\n outer loop\n"
+    "  vertex 0 0 0\n  vertex 1 0 0\n  vertex 1 1 0\n"
+    " endloop\nendfacet\n"
+    "facet normal 0 0 1\n outer loop\n"
+    "  vertex 0 0 0\n  vertex 1 1 0\n  vertex 0 1 0\n"
+    " endloop\nendfacet\n"
+    "endsolid square\n";
+
+// Corners of the same 2 triangles, to be written as a binary STL
+constexpr float SQUARE_STL_CORNERS[2][3][3] = {
+    {{0.0F, 0.0F, 0.0F}, {1.0F, 0.0F, 0.0F}, {1.0F, 1.0F, 0.0F}},
+    {{0.0F, 0.0F, 0.0F}, {1.0F, 1.0F, 0.0F}, {0.0F, 1.0F, 0.0F}}};
+
+// Returns the square as a binary STL (80-byte header, triangle count, and 50
+// bytes per triangle: normal, 3 corners and attribute byte count)
+auto CreateBinarySquareStl() -> std::string {
+    // Starts with "solid" on purpose, as some exporters do for binary files
+    std::string contents = "solid binary square";
+    contents.resize(80, ' ');
+    const uint32_t NUM_TRIANGLES = 2;
+    contents.append(reinterpret_cast<const char*>(&NUM_TRIANGLES),
+                    sizeof(NUM_TRIANGLES));
+    const float NORMAL[3] = {0.0F, 0.0F, 1.0F};  // NOLINT
+    const uint16_t ATTRIBUTES = 0;
+    for (const auto& triangle : SQUARE_STL_CORNERS) {
+        contents.append(reinterpret_cast<const char*>(NORMAL), sizeof(NORMAL));
+        contents.append(reinterpret_cast<const char*>(triangle),
+                        sizeof(triangle));
+        contents.append(reinterpret_cast<const char*>(&ATTRIBUTES),
+                        sizeof(ATTRIBUTES));
+    }
+    return contents;
+}
+
+auto WriteTextFile(const std::string& filepath, const std::string& contents)
+    -> void {
+    std::ofstream file(filepath, std::ios::binary);
+    file << contents;
+}
+
+auto FileExists(const std::string& filepath) -> bool {
+    std::ifstream file(filepath);
+    return file.good();
+}
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("MeshLoader parsing", "[MeshLoader]") {
+    using MeshLoader = ::loco::core::MeshLoader;
+
+    SECTION("OBJ polygons are triangulated as fans") {
+        const std::string FILEPATH = "test_mesh_loader_square.obj";
+        WriteTextFile(FILEPATH, SQUARE_OBJ);
+        auto mesh_data = MeshLoader::Parse(FILEPATH);
+        REQUIRE(mesh_data.filepath == FILEPATH);
+        REQUIRE(mesh_data.n_vertices == 4);
+        REQUIRE(mesh_data.n_faces == 2);
+        REQUIRE(mesh_data.vertices[6] == Approx(1.0));
+        REQUIRE(mesh_data.vertices[7] == Approx(1.0));
+        REQUIRE(mesh_data.faces[3] == 0);
+        REQUIRE(mesh_data.faces[4] == 2);
+        REQUIRE(mesh_data.faces[5] == 3);
+        std::remove(FILEPATH.c_str());
+    }
+
+    SECTION("STL corners are merged into shared vertices") {
+        const std::string FILEPATH = "test_mesh_loader_square.stl";
+        WriteTextFile(FILEPATH, SQUARE_STL);
+        auto mesh_data = MeshLoader::Parse(FILEPATH);
+        REQUIRE(mesh_data.n_vertices == 4);
+        REQUIRE(mesh_data.n_faces == 2);
+        REQUIRE(mesh_data.faces[3] == 0);
+        REQUIRE(mesh_data.faces[4] == 2);
+        REQUIRE(mesh_data.faces[5] == 3);
+        std::remove(FILEPATH.c_str());
+    }
+
+    SECTION("Binary STL files are parsed") {
+        const std::string FILEPATH = "test_mesh_loader_binary.stl";
+        const auto CONTENTS = CreateBinarySquareStl();
+        REQUIRE(CONTENTS.size() == 84 + 50 * 2);
+        WriteTextFile(FILEPATH, CONTENTS);
+        auto mesh_data = MeshLoader::Parse(FILEPATH);
+        REQUIRE(mesh_data.n_vertices == 4);
+        REQUIRE(mesh_data.n_faces == 2);
+        REQUIRE(mesh_data.vertices[6] == Approx(1.0));
+        REQUIRE(mesh_data.vertices[7] == Approx(1.0));
+        REQUIRE(mesh_data.faces[3] == 0);
+        REQUIRE(mesh_data.faces[4] == 2);
+        REQUIRE(mesh_data.faces[5] == 3);
+        std::remove(FILEPATH.c_str());
+    }
+
+    SECTION("OBJ faces with out-of-range indices throw") {
+        const std::string FILEPATH = "test_mesh_loader_invalid.obj";
+        const std::string VERTICES =
+            "v 0.0 0.0 0.0\nv 1.0 0.0 0.0\nv 1.0 1.0 0.0\n";
+        for (const auto* face : {"f 0 1 2\n", "f 1 2 4\n", "f -4 -2 -1\n"}) {
+            WriteTextFile(FILEPATH, VERTICES + face);
+            REQUIRE_THROWS_AS(MeshLoader::Parse(FILEPATH), std::runtime_error);
+        }
+        WriteTextFile(FILEPATH, VERTICES + "f -3 -2 -1\n");
+        REQUIRE(MeshLoader::Parse(FILEPATH).n_faces == 1);
+        std::remove(FILEPATH.c_str());
+    }
+
+    SECTION("Unsupported formats throw") {
+        REQUIRE_THROWS_AS(MeshLoader::Parse("test_mesh_loader.ply"),
+                          std::runtime_error);
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_CASE("MeshLoader caching", "[MeshLoader]") {
+    using MeshLoader = ::loco::core::MeshLoader;
+    const std::string FILEPATH = "test_mesh_loader_cached.obj";
+    // Nested, to check that missing directories are created
+    const std::string CACHE_ROOT = "test_mesh_loader_caches";
+    const std::string CACHE_DIRECTORY = CACHE_ROOT + "/meshes";
+    MeshLoader::SetCacheDirectory(CACHE_DIRECTORY);
+    WriteTextFile(FILEPATH, SQUARE_OBJ);
+    const auto CACHE_PATH = MeshLoader::GetCachePath(FILEPATH);
+    REQUIRE(CACHE_PATH.find(CACHE_DIRECTORY + "/" + FILEPATH) == 0);
+    std::remove(CACHE_PATH.c_str());
+
+    auto parsed = MeshLoader::Load(FILEPATH);
+    REQUIRE(FileExists(CACHE_PATH));
+
+    SECTION("Cached loads return the same data as parsing") {
+        auto cached = MeshLoader::Load(FILEPATH);
+        REQUIRE(cached.filepath == FILEPATH);
+        REQUIRE(cached.n_vertices == parsed.n_vertices);
+        REQUIRE(cached.n_faces == parsed.n_faces);
+        for (size_t i = 0; i < 3 * parsed.n_vertices; ++i) {
+            REQUIRE(cached.vertices[i] == parsed.vertices[i]);
+        }
+        for (size_t i = 0; i < 3 * parsed.n_faces; ++i) {
+            REQUIRE(cached.faces[i] == parsed.faces[i]);
+        }
+
+        // Writing into the buffers never touches the cache file
+        cached.vertices.mutable_data()[0] = 42.0;
+        auto reloaded = MeshLoader::Load(FILEPATH);
+        REQUIRE(reloaded.vertices[0] == parsed.vertices[0]);
+    }
+
+    SECTION("Caches are keyed by the absolute path of the mesh files") {
+        REQUIRE(MeshLoader::GetCachePath("./" + FILEPATH) == CACHE_PATH);
+        REQUIRE(MeshLoader::GetCachePath("robot_a/" + FILEPATH) !=
+                MeshLoader::GetCachePath("robot_b/" + FILEPATH));
+    }
+
+#if !defined(_WIN32)
+    SECTION("Caches go to the user's cache directory by default") {
+        const auto* xdg_cache_home = std::getenv("XDG_CACHE_HOME");
+        const std::string PREVIOUS_XDG_CACHE_HOME =
+            (xdg_cache_home == nullptr) ? "" : xdg_cache_home;
+        setenv("XDG_CACHE_HOME", "/tmp/test_mesh_loader_xdg", 1);
+        MeshLoader::SetCacheDirectory("");
+        REQUIRE(MeshLoader::GetCacheDirectory() ==
+                "/tmp/test_mesh_loader_xdg/loco/meshes");
+        if (xdg_cache_home == nullptr) {
+            unsetenv("XDG_CACHE_HOME");
+        } else {
+            setenv("XDG_CACHE_HOME", PREVIOUS_XDG_CACHE_HOME.c_str(), 1);
+        }
+    }
+#endif
+
+    SECTION("Stale caches are rebuilt when the mesh file changes") {
+        WriteTextFile(FILEPATH, SQUARE_OBJ_EXTENDED);
+        auto updated = MeshLoader::Load(FILEPATH);
+        REQUIRE(updated.n_vertices == 5);
+        REQUIRE(updated.n_faces == 3);
+        REQUIRE(updated.faces[6] == 1);
+        REQUIRE(updated.faces[7] == 4);
+        REQUIRE(updated.faces[8] == 2);
+    }
+
+    SECTION("Corrupted caches are ignored") {
+        WriteTextFile(CACHE_PATH, "not a cache");
+        auto mesh_data = MeshLoader::Load(FILEPATH);
+        REQUIRE(mesh_data.n_vertices == 4);
+        REQUIRE(mesh_data.n_faces == 2);
+    }
+
+    SECTION("Disabled caches are neither read nor written") {
+        std::remove(CACHE_PATH.c_str());
+        MeshLoader::SetCacheEnabled(false);
+        auto mesh_data = MeshLoader::Load(FILEPATH);
+        MeshLoader::SetCacheEnabled(true);
+        REQUIRE(mesh_data.n_faces == 2);
+        REQUIRE_FALSE(FileExists(CACHE_PATH));
+    }
+
+    std::remove(FILEPATH.c_str());
+    std::remove(CACHE_PATH.c_str());
+    std::remove(CACHE_DIRECTORY.c_str());
+    std::remove(CACHE_ROOT.c_str());
+    MeshLoader::SetCacheDirectory("");
+}
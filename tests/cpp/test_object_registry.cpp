@@ -0,0 +1,59 @@
+#include <catch2/catch.hpp>
+#include <loco/core/object_registry_t.hpp>
+
+#include <memory>
+
+// NOLINTNEXTLINE
+TEST_CASE("ObjectRegistry type", "[ObjectRegistry]") {
+    ::loco::core::ObjectRegistry<int> registry;
+    REQUIRE(registry.empty());
+    REQUIRE(registry.num_slots() == 0);
+
+    auto handle_a = registry.Insert(std::make_shared<int>(1));
+    auto handle_b = registry.Insert(std::make_shared<int>(2));
+    REQUIRE(registry.size() == 2);
+    REQUIRE(handle_a.valid());
+    REQUIRE(handle_a != handle_b);
+
+    SECTION("Handles give access to the stored objects") {
+        REQUIRE(registry.IsValid(handle_a));
+        REQUIRE(*registry.Get(handle_a) == 1);
+        REQUIRE(*registry.Get(handle_b) == 2);
+        REQUIRE(registry.HandleAt(handle_b.index) == handle_b);
+        REQUIRE_FALSE(registry.HandleAt(2).valid());
+    }
+
+    SECTION("Default handles don't refer to any object") {
+        ::loco::core::Handle<int> handle;
+        REQUIRE_FALSE(handle.valid());
+        REQUIRE_FALSE(registry.IsValid(handle));
+        REQUIRE(registry.Get(handle) == nullptr);
+    }
+
+    SECTION("Handles to removed objects become stale") {
+        auto removed = registry.Remove(handle_a);
+        REQUIRE(*removed == 1);
+        REQUIRE(registry.size() == 1);
+        REQUIRE_FALSE(registry.IsValid(handle_a));
+        REQUIRE(registry.Get(handle_a) == nullptr);
+        REQUIRE(registry.Remove(handle_a) == nullptr);
+
+        // The free slot is reused, but with a different generation
+        auto handle_c = registry.Insert(std::make_shared<int>(3));
+        REQUIRE(handle_c.index == handle_a.index);
+        REQUIRE(handle_c.generation != handle_a.generation);
+        REQUIRE(registry.num_slots() == 2);
+        REQUIRE(registry.Get(handle_a) == nullptr);
+        REQUIRE(*registry.Get(handle_c) == 3);
+    }
+
+    SECTION("Objects don't move when the registry grows past a chunk") {
+        auto* object_a = registry.Get(handle_a);
+        constexpr size_t NUM_OBJECTS = 4 * decltype(registry)::SLOTS_PER_CHUNK;
+        for (size_t i = 0; i < NUM_OBJECTS; ++i) {
+            registry.Insert(std::make_shared<int>(static_cast<int>(i)));
+        }
+        REQUIRE(registry.size() == NUM_OBJECTS + 2);
+        REQUIRE(registry.Get(handle_a) == object_a);
+    }
+}
@@ -0,0 +1,50 @@
+#include <catch2/catch.hpp>
+
+#if defined(LOCO_VISUALIZER_MESHCAT_ENABLED)
+
+#include <loco/visualizers/meshcat/pose_batch_meshcat.hpp>
+
+// Only the bookkeeping of the batch is tested here, as flushing it requires a
+// running meshcat server
+// NOLINTNEXTLINE
+TEST_CASE("Meshcat pose batch", "[Meshcat]") {
+    ::loco::meshcat::PoseBatchMeshcat batch;
+    const auto BOX_ID = batch.Register("/loco/box");
+    const auto SPHERE_ID = batch.Register("/loco/sphere");
+    REQUIRE(BOX_ID != SPHERE_ID);
+    REQUIRE(batch.num_dirty() == 0);
+
+    Pose pose;
+    pose.position = Vec3(1.0, 2.0, 3.0);
+
+    SECTION("Poses set several times are sent only once") {
+        batch.SetPose(BOX_ID, Pose());
+        batch.SetPose(BOX_ID, pose);
+        REQUIRE(batch.num_dirty() == 1);
+        batch.SetPose(SPHERE_ID, pose);
+        REQUIRE(batch.num_dirty() == 2);
+    }
+
+    SECTION("Unregistered entries drop their pending pose") {
+        batch.SetPose(BOX_ID, pose);
+        batch.Unregister(BOX_ID);
+        REQUIRE(batch.num_dirty() == 0);
+        // Unknown or already released ids are ignored
+        batch.SetPose(BOX_ID, pose);
+        batch.SetPose(SPHERE_ID + 1, pose);
+        batch.Unregister(BOX_ID);
+        REQUIRE(batch.num_dirty() == 0);
+    }
+
+    SECTION("Reused ids are listed once as dirty") {
+        batch.SetPose(BOX_ID, pose);
+        batch.Unregister(BOX_ID);
+        const auto CAPSULE_ID = batch.Register("/loco/capsule");
+        REQUIRE(CAPSULE_ID == BOX_ID);
+        REQUIRE(batch.num_dirty() == 0);
+        batch.SetPose(CAPSULE_ID, pose);
+        REQUIRE(batch.num_dirty() == 1);
+    }
+}
+
+#endif  // LOCO_VISUALIZER_MESHCAT_ENABLED
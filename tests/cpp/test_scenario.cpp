@@ -1,16 +1,122 @@
 #include <catch2/catch.hpp>
 #include <loco/core/scenario_t.hpp>
+#include <loco/core/visualizer/drawable_primitives.hpp>
+
+#include <memory>
+#include <string>
+
+namespace {
+/// Adapter that only counts the updates it receives from its drawable
+class CountingDrawableImpl : public ::loco::core::DrawableImplNone {
+ public:
+    explicit CountingDrawableImpl(size_t& num_poses) : m_NumPoses(num_poses) {}
+
+    auto SetPose(const Pose& /*pose*/) -> void override { m_NumPoses++; }
+
+ private:
+    size_t& m_NumPoses;
+};
+}  // namespace
 
 // NOLINTNEXTLINE
 TEST_CASE("Scenario type", "[Scenario]") {
-    SECTION("Default constructor") {
-        ::loco::core::Scenario test_scenario;
-        REQUIRE(test_scenario.num_bodies() == 0);
-        REQUIRE(test_scenario.empty());
-        REQUIRE_FALSE(test_scenario.toString().empty());
-
-        REQUIRE(test_scenario.bodies.empty());
-        REQUIRE(test_scenario.bodies.capacity() ==
-                ::loco::core::Scenario::MAX_BODIES);
+    ::loco::core::Scenario scenario;
+    REQUIRE(scenario.num_drawables() == 0);
+    REQUIRE(scenario.num_single_bodies() == 0);
+    REQUIRE(scenario.num_colliders() == 0);
+    REQUIRE_FALSE(scenario.ToString().empty());
+
+    SECTION("Drawables can be retrieved by handle, name and index") {
+        auto box = std::make_shared<::loco::core::viz::Box>(
+            "box", Vec3(0.0, 0.0, 1.0), Vec3(0.2, 0.2, 0.2));
+        auto sphere = std::make_shared<::loco::core::viz::Sphere>(
+            "sphere", Vec3(1.0, 0.0, 1.0), 0.1F);
+        auto box_handle = scenario.AddDrawable(box);
+        auto sphere_handle = scenario.AddDrawable(sphere);
+        REQUIRE(scenario.num_drawables() == 2);
+
+        REQUIRE(scenario.GetDrawable(box_handle) == box.get());
+        REQUIRE(scenario.GetDrawable(sphere_handle) == sphere.get());
+        REQUIRE(scenario.FindDrawable("sphere") == sphere_handle);
+        REQUIRE_FALSE(scenario.FindDrawable("cylinder").valid());
+        REQUIRE(scenario.GetDrawableByName("box") == box);
+        REQUIRE(scenario.GetDrawableByName("cylinder") == nullptr);
+        REQUIRE(scenario.GetDrawableByIndex(box_handle.index) == box);
+        REQUIRE(scenario.GetDrawableByIndex(2) == nullptr);
+
+        ::loco::core::DrawableHandle stale_handle{box_handle.index,
+                                                  box_handle.generation + 1};
+        REQUIRE(scenario.GetDrawable(stale_handle) == nullptr);
+    }
+
+    SECTION("Drawables can be removed, and their slots are reused") {
+        auto box = std::make_shared<::loco::core::viz::Box>(
+            "box", Vec3(0.0, 0.0, 1.0), Vec3(0.2, 0.2, 0.2));
+        auto box_handle = scenario.AddDrawable(box);
+        REQUIRE(scenario.RemoveDrawable(box_handle) == box);
+        REQUIRE(scenario.num_drawables() == 0);
+        REQUIRE(scenario.GetDrawable(box_handle) == nullptr);
+        REQUIRE_FALSE(scenario.FindDrawable("box").valid());
+        REQUIRE(scenario.RemoveDrawable(box_handle) == nullptr);
+
+        auto sphere = std::make_shared<::loco::core::viz::Sphere>(
+            "sphere", Vec3(1.0, 0.0, 1.0), 0.1F);
+        auto sphere_handle = scenario.AddDrawable(sphere);
+        REQUIRE(sphere_handle.index == box_handle.index);
+        REQUIRE(scenario.num_drawable_slots() == 1);
+        REQUIRE(scenario.GetDrawable(box_handle) == nullptr);
+    }
+
+    SECTION("There's no upper limit on the number of drawables") {
+        constexpr size_t NUM_DRAWABLES = 4096;
+        for (size_t i = 0; i < NUM_DRAWABLES; ++i) {
+            scenario.AddDrawable(std::make_shared<::loco::core::viz::Sphere>(
+                "sphere_" + std::to_string(i), Vec3(0.0, 0.0, 0.0), 0.1F));
+        }
+        REQUIRE(scenario.num_drawables() == NUM_DRAWABLES);
+        REQUIRE(scenario.GetDrawableByName("sphere_4095") != nullptr);
+    }
+
+    SECTION("Drawable changes are coalesced until the drawables are synced") {
+        size_t num_poses = 0;
+        auto box = std::make_shared<::loco::core::viz::Box>(
+            "box", Vec3(0.0, 0.0, 1.0), Vec3(0.2, 0.2, 0.2));
+        box->SetAdapter(std::make_unique<CountingDrawableImpl>(num_poses));
+        scenario.AddDrawable(box);
+
+        box->SetPosition(Vec3(0.0, 0.0, 2.0));
+        box->SetPosition(Vec3(0.0, 0.0, 3.0));
+        box->SetVisible(false);
+        REQUIRE(num_poses == 0);
+        REQUIRE(scenario.num_dirty_drawables() == 1);
+        REQUIRE((box->dirty_flags() & ::loco::core::Drawable::DIRTY_POSE) != 0);
+
+        scenario.SyncDrawables();
+        REQUIRE(num_poses == 1);
+        REQUIRE(scenario.num_dirty_drawables() == 0);
+        REQUIRE(box->dirty_flags() == 0);
+
+        // Nothing is sent if nothing changed
+        scenario.SyncDrawables();
+        REQUIRE(num_poses == 1);
+
+        // Once removed from the scenario, changes are sent right away
+        scenario.RemoveDrawable(scenario.FindDrawable("box"));
+        box->SetPosition(Vec3(0.0, 0.0, 4.0));
+        REQUIRE(num_poses == 2);
+    }
+
+    SECTION("Single bodies and colliders can be retrieved by handle") {
+        auto body = std::make_shared<::loco::core::SingleBody>(
+            ::loco::BodyData(), Vec3(0.0, 0.0, 1.0));
+        auto body_handle = scenario.AddSingleBody(body);
+        REQUIRE(scenario.GetSingleBody(body_handle) == body.get());
+        REQUIRE(scenario.GetSingleBodyByIndex(body_handle.index) == body);
+
+        auto collider = std::make_shared<::loco::core::SingleBodyCollider>(
+            ::loco::ColliderData());
+        auto collider_handle = scenario.AddCollider(collider);
+        REQUIRE(scenario.num_colliders() == 1);
+        REQUIRE(scenario.GetCollider(collider_handle) == collider.get());
     }
 }
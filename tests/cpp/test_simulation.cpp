@@ -0,0 +1,63 @@
+#include <catch2/catch.hpp>
+#include <loco/core/simulation_t.hpp>
+
+#include <vector>
+
+// NOLINTNEXTLINE
+TEST_CASE("Simulation type", "[Simulation]") {
+    auto scenario = std::make_shared<::loco::core::Scenario>();
+    ::loco::core::Simulation simulation(scenario, ::loco::eBackendType::NONE);
+    REQUIRE(simulation.backend_type() == ::loco::eBackendType::NONE);
+    REQUIRE(simulation.Poll());
+    REQUIRE_THROWS(simulation.impl());
+    REQUIRE(simulation.state_size() == 0);
+    REQUIRE_THROWS(simulation.stats());
+
+    std::vector<uint8_t> snapshot;
+    REQUIRE_THROWS(simulation.SaveState(snapshot));
+
+    simulation.Init();
+    REQUIRE_NOTHROW(simulation.impl());
+
+    SECTION("State snapshots can be saved and restored") {
+        simulation.SaveState(snapshot);
+        REQUIRE(snapshot.size() == simulation.state_size());
+        REQUIRE_NOTHROW(simulation.LoadState(snapshot));
+
+        std::vector<uint8_t> wrong_snapshot(simulation.state_size() + 1);
+        REQUIRE_THROWS(simulation.LoadState(wrong_snapshot));
+    }
+
+    SECTION("Asynchronous steps can be waited for") {
+        auto handle = simulation.StepAsync(ToScalar(0.01));
+        REQUIRE(handle.valid());
+        simulation.Wait();
+        REQUIRE(simulation.Poll());
+        REQUIRE(handle.wait_for(std::chrono::seconds(0)) ==
+                std::future_status::ready);
+    }
+
+    SECTION("Synchronous calls wait for the pending asynchronous step") {
+        constexpr size_t NUM_STEPS = 100;
+        auto pool = std::make_shared<::loco::core::ThreadPool>(2);
+        simulation.SetThreadPool(pool);
+        for (size_t i = 0; i < NUM_STEPS; ++i) {
+            simulation.StepAsync(ToScalar(0.01));
+            simulation.Step(ToScalar(0.01));
+        }
+        simulation.StepAsync(ToScalar(0.01));
+        simulation.Reset();
+        REQUIRE(simulation.Poll());
+        REQUIRE(simulation.stats().num_steps == 2 * NUM_STEPS + 1);
+    }
+
+    SECTION("Steps update the stats kept by the backend") {
+        const auto& stats = simulation.stats();
+        REQUIRE(stats.num_steps == 0);
+        simulation.Step(ToScalar(0.01));
+        simulation.Step(ToScalar(0.01));
+        REQUIRE(stats.num_steps == 2);
+        REQUIRE(stats.step_time >= 0.0);
+        REQUIRE(&stats == &simulation.stats());
+    }
+}
@@ -0,0 +1,63 @@
+#include <catch2/catch.hpp>
+#include <loco/core/simulation_batch_t.hpp>
+
+#include <vector>
+
+// NOLINTNEXTLINE
+TEST_CASE("SimulationBatch type", "[SimulationBatch]") {
+    constexpr size_t NUM_ENVS = 8;
+    constexpr size_t OBS_DIM = 3;
+
+    size_t num_scenarios_created = 0;
+    auto factory = [&](size_t) -> ::loco::core::Scenario::ptr {
+        num_scenarios_created++;
+        return std::make_shared<::loco::core::Scenario>();
+    };
+
+    ::loco::core::SimulationBatch batch(NUM_ENVS, factory,
+                                        ::loco::eBackendType::NONE);
+    REQUIRE(num_scenarios_created == NUM_ENVS);
+    REQUIRE(batch.num_envs() == NUM_ENVS);
+    REQUIRE(batch.obs_dim() == 0);
+    REQUIRE(batch.backend_type() == ::loco::eBackendType::NONE);
+    REQUIRE(batch.scenario(0) != batch.scenario(1));
+
+    SECTION("Observations are written into a single contiguous buffer") {
+        std::vector<size_t> num_collects(NUM_ENVS, 0);
+        batch.SetObservationFn(
+            OBS_DIM, [&](size_t env_index, const ::loco::core::Simulation&,
+                         Scalar* obs) {
+                num_collects[env_index]++;
+                for (size_t k = 0; k < OBS_DIM; ++k) {
+                    obs[k] = ToScalar(env_index * OBS_DIM + k);
+                }
+            });
+        REQUIRE(batch.obs_dim() == OBS_DIM);
+
+        batch.Init();
+        batch.StepAll(ToScalar(0.01));
+        for (size_t i = 0; i < NUM_ENVS * OBS_DIM; ++i) {
+            REQUIRE(batch.observations()[i] == ToScalar(i));
+        }
+        for (size_t i = 0; i < NUM_ENVS; ++i) {
+            REQUIRE(num_collects[i] == 2);
+        }
+
+        std::vector<bool> mask(NUM_ENVS, false);
+        mask[1] = true;
+        mask[5] = true;
+        batch.ResetSome(mask);
+        for (size_t i = 0; i < NUM_ENVS; ++i) {
+            REQUIRE(num_collects[i] == (mask[i] ? 3 : 2));
+        }
+    }
+
+    SECTION("Invalid arguments are rejected") {
+        batch.Init();
+        REQUIRE_THROWS(batch.ResetSome(std::vector<bool>(NUM_ENVS + 1)));
+        REQUIRE_THROWS(batch.simulation(NUM_ENVS));
+        REQUIRE_THROWS(batch.scenario(NUM_ENVS));
+        REQUIRE_THROWS(::loco::core::SimulationBatch(
+            2, [](size_t) { return nullptr; }, ::loco::eBackendType::NONE));
+    }
+}
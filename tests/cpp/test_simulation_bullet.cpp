@@ -0,0 +1,258 @@
+#include <catch2/catch.hpp>
+
+#if defined(LOCO_BULLET_ENABLED)
+
+#include <loco/backends/bullet/simulation_impl_bullet.hpp>
+
+#if defined(LOCO_BULLET_MULTITHREADING_ENABLED)
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
+#endif
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace {
+/// Sphere added straight into the world of a Bullet backend (which has no
+/// adapters for single bodies yet), removed from it on destruction. It's
+/// static if given a zero mass
+struct BulletSphere {
+    BulletSphere(btDynamicsWorld& world, const btVector3& position,
+                 btScalar radius = 0.1, btScalar mass = 1.0)
+        : world(world), shape(std::make_unique<btSphereShape>(radius)) {
+        btVector3 inertia(0.0, 0.0, 0.0);
+        if (mass > 0.0) {
+            shape->calculateLocalInertia(mass, inertia);
+        }
+        btTransform tf;
+        tf.setIdentity();
+        tf.setOrigin(position);
+        motion_state = std::make_unique<btDefaultMotionState>(tf);
+        body = std::make_unique<btRigidBody>(mass, motion_state.get(),
+                                             shape.get(), inertia);
+        world.addRigidBody(body.get());
+    }
+
+    ~BulletSphere() { world.removeRigidBody(body.get()); }
+
+    btDynamicsWorld& world;
+    std::unique_ptr<btSphereShape> shape;
+    std::unique_ptr<btDefaultMotionState> motion_state;
+    std::unique_ptr<btRigidBody> body;
+};
+
+/// Creates an initialized Bullet backend for an empty scenario
+auto CreateBackend(bool fixed_substeps, bool profile_phases = false)
+    -> ::loco::bullet::SimulationImplBullet::uptr {
+    ::loco::SimulationConfig config;
+    config.fixed_substeps = fixed_substeps;
+    config.profile_phases = profile_phases;
+    auto backend = std::make_unique<::loco::bullet::SimulationImplBullet>(
+        std::make_shared<::loco::core::Scenario>(), config);
+    backend->Init();
+    return backend;
+}
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("Bullet backend", "[Bullet]") {
+    // Powers of two, so the default mode takes exactly 4 substeps as well
+    constexpr Scalar TIMESTEP = ToScalar(1.0 / 256.0);
+    constexpr Scalar STEP = 4 * TIMESTEP;
+    constexpr size_t NUM_STEPS = 25;
+
+    SECTION("Fixed substeps apply forces like the default mode") {
+        auto default_backend = CreateBackend(false);
+        auto fixed_backend = CreateBackend(true);
+        BulletSphere default_sphere(default_backend->bullet_world(),
+                                    btVector3(0.0, 0.0, 0.0));
+        BulletSphere fixed_sphere(fixed_backend->bullet_world(),
+                                  btVector3(0.0, 0.0, 0.0));
+        const btVector3 FORCE(1.0, 0.0, 0.0);
+        for (auto* backend : {default_backend.get(), fixed_backend.get()}) {
+            backend->SetTimeStep(TIMESTEP);
+            backend->SetGravity(Vec3(0.0, 0.0, 0.0));
+        }
+
+        for (size_t i = 0; i < NUM_STEPS; ++i) {
+            // Bullet clears the applied forces after each step
+            default_sphere.body->applyCentralForce(FORCE);
+            fixed_sphere.body->applyCentralForce(FORCE);
+            default_backend->Step(STEP);
+            fixed_backend->Step(STEP);
+            REQUIRE(fixed_backend->last_num_substeps() == 4);
+        }
+
+        // Semi-implicit Euler with a unit mass: x_n = F * dt^2 * n(n + 1) / 2
+        const auto NUM_SUBSTEPS = static_cast<double>(4 * NUM_STEPS);
+        const auto EXPECTED_X = static_cast<double>(TIMESTEP * TIMESTEP) *
+                                NUM_SUBSTEPS * (NUM_SUBSTEPS + 1.0) / 2.0;
+        const auto DEFAULT_X =
+            default_sphere.body->getWorldTransform().getOrigin().x();
+        const auto FIXED_X =
+            fixed_sphere.body->getWorldTransform().getOrigin().x();
+        REQUIRE(FIXED_X == Approx(DEFAULT_X));
+        REQUIRE(FIXED_X == Approx(EXPECTED_X));
+        REQUIRE(fixed_backend->num_substeps_taken() == 4 * NUM_STEPS);
+    }
+
+    SECTION("Fixed substeps leave motion states at the actual transforms") {
+        auto backend = CreateBackend(true);
+        backend->SetTimeStep(TIMESTEP);
+        BulletSphere sphere(backend->bullet_world(), btVector3(0.0, 0.0, 1.0));
+        sphere.body->setLinearVelocity(btVector3(1.0, 0.0, 0.0));
+        // Steps that aren't multiples of the timestep would leave leftover
+        // time in stepSimulation, which extrapolates the motion states
+        for (const auto step : {STEP, ToScalar(2.5) * TIMESTEP, STEP}) {
+            backend->Step(step);
+            btTransform motion_tf;
+            sphere.motion_state->getWorldTransform(motion_tf);
+            const auto& body_tf = sphere.body->getWorldTransform();
+            for (int i = 0; i < 3; ++i) {
+                REQUIRE(motion_tf.getOrigin()[i] ==
+                        Approx(body_tf.getOrigin()[i]));
+            }
+        }
+        REQUIRE(backend->last_num_substeps() == 4);
+    }
+
+    SECTION("The default mode reports the substeps it actually took") {
+        auto backend = CreateBackend(false);
+        backend->SetTimeStep(TIMESTEP);
+        BulletSphere sphere(backend->bullet_world(), btVector3(0.0, 0.0, 1.0));
+        // Much longer than the max. number of substeps, which Bullet drops
+        backend->Step(1000 * TIMESTEP);
+        REQUIRE(backend->last_num_substeps() < 1000);
+        REQUIRE(backend->num_substeps_taken() == backend->last_num_substeps());
+    }
+
+    SECTION("Snapshots replay the same steps, sleeping bodies included") {
+        auto backend = CreateBackend(false);
+        backend->SetTimeStep(TIMESTEP);
+        BulletSphere sleeping_sphere(backend->bullet_world(),
+                                     btVector3(0.0, 0.0, 1.0));
+        BulletSphere falling_sphere(backend->bullet_world(),
+                                    btVector3(1.0, 0.0, 1.0));
+        sleeping_sphere.body->forceActivationState(ISLAND_SLEEPING);
+
+        std::vector<uint8_t> snapshot(backend->state_size());
+        backend->SaveState(snapshot.data());
+        for (size_t i = 0; i < NUM_STEPS; ++i) {
+            backend->Step(STEP);
+        }
+        std::vector<uint8_t> expected_state(backend->state_size());
+        backend->SaveState(expected_state.data());
+
+        // Wake the sleeping body up, which the snapshot should undo
+        sleeping_sphere.body->activate(true);
+        for (size_t i = 0; i < NUM_STEPS; ++i) {
+            backend->Step(STEP);
+        }
+
+        backend->LoadState(snapshot.data());
+        REQUIRE(sleeping_sphere.body->getActivationState() == ISLAND_SLEEPING);
+        for (size_t i = 0; i < NUM_STEPS; ++i) {
+            backend->Step(STEP);
+        }
+        std::vector<uint8_t> replayed_state(backend->state_size());
+        backend->SaveState(replayed_state.data());
+        REQUIRE(replayed_state == expected_state);
+        REQUIRE(sleeping_sphere.body->getWorldTransform().getOrigin().z() ==
+                Approx(1.0));
+    }
+
+    SECTION("Multithreaded worlds are built when available") {
+        ::loco::SimulationConfig config;
+        config.multithreaded = true;
+        // Bullet is usually built without TBB, so this falls back to the
+        // scheduler built on top of std::thread
+        config.task_scheduler = ::loco::eTaskSchedulerType::TBB;
+        config.solver_iterations = 7;
+        auto backend = std::make_unique<::loco::bullet::SimulationImplBullet>(
+            std::make_shared<::loco::core::Scenario>(), config);
+        REQUIRE_NOTHROW(backend->Init());
+#if defined(LOCO_BULLET_MULTITHREADING_ENABLED)
+        REQUIRE(backend->multithreaded());
+        REQUIRE(dynamic_cast<btDiscreteDynamicsWorldMt*>(
+                    &backend->bullet_world()) != nullptr);
+#else
+        REQUIRE(!backend->multithreaded());
+#endif
+        REQUIRE(backend->bullet_world().getSolverInfo().m_numIterations == 7);
+
+        // Either world simulates the same falling body
+        auto reference = CreateBackend(false);
+        BulletSphere sphere(backend->bullet_world(), btVector3(0.0, 0.0, 1.0));
+        BulletSphere reference_sphere(reference->bullet_world(),
+                                      btVector3(0.0, 0.0, 1.0));
+        for (size_t i = 0; i < NUM_STEPS; ++i) {
+            backend->Step(STEP);
+            reference->Step(STEP);
+        }
+        REQUIRE(sphere.body->getWorldTransform().getOrigin().z() ==
+                Approx(reference_sphere.body->getWorldTransform()
+                           .getOrigin()
+                           .z()));
+        REQUIRE(sphere.body->getWorldTransform().getOrigin().z() < 1.0);
+
+        auto single_config = config;
+        single_config.multithreaded = false;
+        ::loco::bullet::SimulationImplBullet single_backend(
+            std::make_shared<::loco::core::Scenario>(), single_config);
+        single_backend.Init();
+        REQUIRE(!single_backend.multithreaded());
+        REQUIRE(single_backend.bullet_world().getSolverInfo().m_numIterations ==
+                7);
+    }
+
+    SECTION("Snapshots replay deterministically from resting contacts") {
+        auto backend = CreateBackend(false);
+        backend->SetTimeStep(TIMESTEP);
+        auto& world = backend->bullet_world();
+        BulletSphere ground(world, btVector3(0.0, 0.0, -10.0), 10.0, 0.0);
+        BulletSphere sphere(world, btVector3(0.0, 0.0, 0.1));
+        for (size_t i = 0; i < NUM_STEPS; ++i) {
+            backend->Step(STEP);
+        }
+        REQUIRE(world.getDispatcher()->getNumManifolds() == 1);
+
+        std::vector<uint8_t> snapshot(backend->state_size());
+        backend->SaveState(snapshot.data());
+        // The contact cache is rebuilt from the loaded transforms: the pair
+        // is kept, but its manifold (and warmstart impulses) are gone
+        std::vector<std::vector<uint8_t>> replays;
+        for (size_t replay = 0; replay < 2; ++replay) {
+            backend->LoadState(snapshot.data());
+            REQUIRE(world.getDispatcher()->getNumManifolds() == 0);
+            REQUIRE(world.getBroadphase()
+                        ->getOverlappingPairCache()
+                        ->getNumOverlappingPairs() == 1);
+            for (size_t i = 0; i < NUM_STEPS; ++i) {
+                backend->Step(STEP);
+            }
+            replays.emplace_back(backend->state_size());
+            backend->SaveState(replays.back().data());
+        }
+        REQUIRE(replays[0] == replays[1]);
+        REQUIRE(sphere.body->getWorldTransform().getOrigin().z() ==
+                Approx(0.1).margin(0.01));
+    }
+
+    SECTION("Phase times are only measured when profiling the phases") {
+        auto backend = CreateBackend(false);
+        auto profiled_backend = CreateBackend(false, true);
+        BulletSphere sphere(backend->bullet_world(), btVector3(0.0, 0.0, 1.0));
+        BulletSphere profiled_sphere(profiled_backend->bullet_world(),
+                                     btVector3(0.0, 0.0, 1.0));
+        backend->Step(STEP);
+        profiled_backend->Step(STEP);
+
+        REQUIRE(backend->stats().collision_time == 0.0);
+        REQUIRE(backend->stats().solver_time == 0.0);
+        REQUIRE(profiled_backend->stats().collision_time > 0.0);
+        REQUIRE(profiled_backend->stats().solver_time > 0.0);
+        REQUIRE(profiled_backend->stats().num_constraint_rows == 0);
+    }
+}
+
+#endif  // LOCO_BULLET_ENABLED
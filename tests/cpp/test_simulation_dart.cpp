@@ -0,0 +1,149 @@
+#include <catch2/catch.hpp>
+
+#if defined(LOCO_DART_ENABLED)
+
+#include <loco/backends/dart/simulation_impl_dart.hpp>
+
+#include <dart/collision/bullet/BulletCollisionDetector.hpp>
+#include <dart/collision/dart/DARTCollisionDetector.hpp>
+#include <dart/collision/fcl/FCLCollisionDetector.hpp>
+#include <dart/collision/ode/OdeCollisionDetector.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+/// Creates an initialized DART backend for an empty scenario
+auto CreateBackend(::loco::eCollisionDetectorType detector,
+                   bool fixed_substeps)
+    -> ::loco::dart::SimulationImplDart::uptr {
+    ::loco::SimulationConfig config;
+    config.collision_detector = detector;
+    config.fixed_substeps = fixed_substeps;
+    auto backend = std::make_unique<::loco::dart::SimulationImplDart>(
+        std::make_shared<::loco::core::Scenario>(), config);
+    backend->Init();
+    return backend;
+}
+
+/// Creates a skeleton with a single box, welded to the world if not dynamic
+auto CreateBox(const std::string& name, const Eigen::Vector3d& size,
+               const Eigen::Vector3d& position, bool dynamic)
+    -> ::dart::dynamics::SkeletonPtr {
+    auto skeleton = ::dart::dynamics::Skeleton::create(name);
+    auto shape = std::make_shared<::dart::dynamics::BoxShape>(size);
+    Eigen::Isometry3d tf = Eigen::Isometry3d::Identity();
+    tf.translation() = position;
+    ::dart::dynamics::BodyNode* body = nullptr;
+    if (dynamic) {
+        auto pair = skeleton->createJointAndBodyNodePair<
+            ::dart::dynamics::FreeJoint>();
+        body = pair.second;
+        skeleton->setPositions(
+            ::dart::dynamics::FreeJoint::convertToPositions(tf));
+    } else {
+        auto pair = skeleton->createJointAndBodyNodePair<
+            ::dart::dynamics::WeldJoint>();
+        body = pair.second;
+        pair.first->setTransformFromParentBodyNode(tf);
+    }
+    body->createShapeNodeWith<::dart::dynamics::CollisionAspect,
+                              ::dart::dynamics::DynamicsAspect>(shape);
+    ::dart::dynamics::Inertia inertia;
+    inertia.setMass(1.0);
+    inertia.setMoment(shape->computeInertia(1.0));
+    body->setInertia(inertia);
+    return skeleton;
+}
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("DART backend", "[DART]") {
+    constexpr Scalar TIMESTEP = ToScalar(0.001);
+    constexpr Scalar STEP = ToScalar(1.0 / 60.0);
+    constexpr size_t NUM_STEPS = 30;
+    using eCollisionDetectorType = ::loco::eCollisionDetectorType;
+
+    SECTION("The requested collision detector is used") {
+        const std::vector<std::pair<eCollisionDetectorType, std::string>>
+            DETECTORS = {
+                {eCollisionDetectorType::DEFAULT,
+                 ::dart::collision::OdeCollisionDetector::getStaticType()},
+                {eCollisionDetectorType::ODE,
+                 ::dart::collision::OdeCollisionDetector::getStaticType()},
+                {eCollisionDetectorType::FCL,
+                 ::dart::collision::FCLCollisionDetector::getStaticType()},
+                {eCollisionDetectorType::BULLET,
+                 ::dart::collision::BulletCollisionDetector::getStaticType()},
+                {eCollisionDetectorType::DART,
+                 ::dart::collision::DARTCollisionDetector::getStaticType()},
+            };
+        for (const auto& detector : DETECTORS) {
+            auto backend = CreateBackend(detector.first, false);
+            const auto& solver = *backend->dart_world().getConstraintSolver();
+            REQUIRE(solver.getCollisionDetector()->getType() ==
+                    detector.second);
+        }
+    }
+
+    SECTION("Fixed substeps take round(step / timestep) substeps") {
+        auto backend = CreateBackend(eCollisionDetectorType::DEFAULT, true);
+        backend->SetTimeStep(TIMESTEP);
+        // 16.67 substeps, rounded to 17
+        REQUIRE(backend->num_substeps(STEP) == 17);
+        REQUIRE(backend->num_substeps(ToScalar(0.0001)) == 1);
+        for (size_t i = 0; i < NUM_STEPS; ++i) {
+            backend->Step(STEP);
+            REQUIRE(backend->stats().num_substeps == 17);
+        }
+        REQUIRE(backend->dart_world().getTime() ==
+                Approx(NUM_STEPS * 17 * static_cast<double>(TIMESTEP)));
+    }
+
+    SECTION("Boxes resting on the ground report their contacts") {
+        auto backend = CreateBackend(eCollisionDetectorType::DEFAULT, true);
+        backend->SetTimeStep(TIMESTEP);
+        auto& world = backend->dart_world();
+        world.addSkeleton(CreateBox("ground", Eigen::Vector3d(4.0, 4.0, 0.2),
+                                    Eigen::Vector3d(0.0, 0.0, -0.1), false));
+        world.addSkeleton(CreateBox("box", Eigen::Vector3d::Constant(0.2),
+                                    Eigen::Vector3d(0.0, 0.0, 0.15), true));
+        for (size_t i = 0; i < NUM_STEPS; ++i) {
+            backend->Step(STEP);
+        }
+        REQUIRE(backend->stats().num_contacts > 0);
+        REQUIRE(world.getSkeleton("box")->getPosition(5) ==
+                Approx(0.1).margin(0.01));
+    }
+
+    SECTION("Snapshots replay the same steps") {
+        auto backend = CreateBackend(eCollisionDetectorType::DEFAULT, true);
+        backend->SetTimeStep(TIMESTEP);
+        backend->dart_world().addSkeleton(
+            CreateBox("box", Eigen::Vector3d::Constant(0.2),
+                      Eigen::Vector3d(0.0, 0.0, 1.0), true));
+
+        std::vector<uint8_t> snapshot(backend->state_size());
+        REQUIRE(!snapshot.empty());
+        backend->SaveState(snapshot.data());
+        for (size_t i = 0; i < NUM_STEPS; ++i) {
+            backend->Step(STEP);
+        }
+        std::vector<uint8_t> expected_state(backend->state_size());
+        backend->SaveState(expected_state.data());
+
+        backend->LoadState(snapshot.data());
+        REQUIRE(backend->dart_world().getTime() == 0.0);
+        for (size_t i = 0; i < NUM_STEPS; ++i) {
+            backend->Step(STEP);
+        }
+        std::vector<uint8_t> replayed_state(backend->state_size());
+        backend->SaveState(replayed_state.data());
+        REQUIRE(replayed_state == expected_state);
+    }
+}
+
+#endif  // LOCO_DART_ENABLED
@@ -0,0 +1,181 @@
+#include <catch2/catch.hpp>
+
+#if defined(LOCO_MUJOCO_ENABLED)
+
+#include <loco/backends/mujoco/simulation_impl_mujoco.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+// A free-falling sphere (single body with a free joint)
+constexpr const char* FALLING_SPHERE_XML =
+    "<mujoco>\n"
+    "  <option timestep=\"0.002\"/>\n"
+    "  <worldbody>\n"
+    "    <body pos=\"0 0 1\">\n"
+    "      <freejoint/>\n"
+    "      <geom type=\"sphere\" size=\"0.1\"/>\n"
+    "    </body>\n"
+    "  </worldbody>\n"
+    "</mujoco>\n";
+
+// Compiles the falling sphere (MuJoCo only loads XML models from files)
+auto LoadFallingSphere() -> mjModel* {
+    const std::string FILEPATH = "test_simulation_mujoco_sphere.xml";
+    {
+        std::ofstream file(FILEPATH);
+        file << FALLING_SPHERE_XML;
+    }
+    std::array<char, 1000> error{};
+    auto* model = mj_loadXML(FILEPATH.c_str(), nullptr, error.data(),
+                             static_cast<int>(error.size()));
+    std::remove(FILEPATH.c_str());
+    if (model == nullptr) {
+        throw std::runtime_error(error.data());
+    }
+    return model;
+}
+
+// Backend with the falling sphere loaded (Init doesn't build models yet)
+class SimulationImplMujocoTest : public ::loco::mujoco::SimulationImplMujoco {
+ public:
+    SimulationImplMujocoTest()
+        : SimulationImplMujoco(std::make_shared<::loco::core::Scenario>(),
+                               ::loco::SimulationConfig()) {
+        _SetModel(LoadFallingSphere());
+    }
+};
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("MuJoCo backend", "[MuJoCo]") {
+    SimulationImplMujocoTest backend;
+    constexpr Scalar STEP = ToScalar(0.02);
+    constexpr size_t NUM_STEPS = 10;
+
+    SECTION("Snapshots replay the same steps") {
+        std::vector<uint8_t> snapshot(backend.state_size());
+        REQUIRE(!snapshot.empty());
+        backend.SaveState(snapshot.data());
+        for (size_t i = 0; i < NUM_STEPS; ++i) {
+            backend.Step(STEP);
+        }
+        std::vector<uint8_t> expected_state(backend.state_size());
+        backend.SaveState(expected_state.data());
+        REQUIRE(backend.mujoco_data().qpos[2] < 1.0);
+
+        backend.LoadState(snapshot.data());
+        REQUIRE(backend.mujoco_data().qpos[2] == Approx(1.0));
+        for (size_t i = 0; i < NUM_STEPS; ++i) {
+            backend.Step(STEP);
+        }
+        std::vector<uint8_t> replayed_state(backend.state_size());
+        backend.SaveState(replayed_state.data());
+        REQUIRE(replayed_state == expected_state);
+    }
+
+    SECTION("Fixed substeps take round(step / timestep) substeps, no drift") {
+        backend.SetFixedSubsteps(true);
+        const auto TIMESTEP = backend.mujoco_model().opt.timestep;
+        // Neither 0.02 nor 0.002 are exact in binary, so the default mode
+        // would take an extra substep whenever the error accumulates
+        constexpr size_t NUM_FIXED_STEPS = 1000;
+        for (size_t i = 0; i < NUM_FIXED_STEPS; ++i) {
+            backend.Step(STEP);
+            REQUIRE(backend.stats().num_substeps == 10);
+        }
+        REQUIRE(backend.mujoco_data().time ==
+                Approx(NUM_FIXED_STEPS * 10 * TIMESTEP));
+
+        // Steps that aren't multiples of the timestep are rounded
+        REQUIRE(backend.num_substeps(ToScalar(0.0209)) == 10);
+        REQUIRE(backend.num_substeps(ToScalar(0.0211)) == 11);
+        REQUIRE(backend.num_substeps(ToScalar(0.0001)) == 1);
+        const auto TIME_START = backend.mujoco_data().time;
+        backend.Step(ToScalar(0.0209));
+        REQUIRE(backend.stats().num_substeps == 10);
+        REQUIRE(backend.mujoco_data().time - TIME_START ==
+                Approx(10 * TIMESTEP));
+    }
+
+    SECTION("The control callback runs once per substep, between phases") {
+        backend.SetFixedSubsteps(true);
+        const auto& model = backend.mujoco_model();
+        size_t num_calls = 0;
+        backend.SetControlCallback([&](const mjModel& m, mjData& d) {
+            // mj_step1 already ran (body poses match the current qpos), but
+            // mj_step2 didn't integrate this substep yet
+            REQUIRE(d.time == Approx(num_calls * m.opt.timestep));
+            REQUIRE(d.xpos[3 * 1 + 2] == Approx(d.qpos[2]));
+            num_calls++;
+        });
+        backend.Step(STEP);
+        REQUIRE(num_calls == backend.num_substeps(STEP));
+        backend.Step(STEP);
+        REQUIRE(num_calls == 2 * backend.num_substeps(STEP));
+
+        // A control set by the callback applies to that same substep: here
+        // gravity is cancelled, so a single substep leaves the sphere at rest
+        backend.mujoco_data().qvel[2] = 0.0;
+        backend.SetControlCallback([](const mjModel& m, mjData& d) {
+            d.qfrc_applied[2] = -m.body_mass[1] * m.opt.gravity[2];
+        });
+        backend.Step(static_cast<Scalar>(model.opt.timestep));
+        REQUIRE(backend.stats().num_substeps == 1);
+        REQUIRE(backend.mujoco_data().qvel[2] == Approx(0.0).margin(1e-9));
+
+        backend.SetControlCallback(nullptr);
+        backend.mujoco_data().qfrc_applied[2] = 0.0;
+        backend.Step(static_cast<Scalar>(model.opt.timestep));
+        REQUIRE(backend.mujoco_data().qvel[2] ==
+                Approx(model.opt.gravity[2] * model.opt.timestep));
+    }
+
+    SECTION("The global timer callback is only installed when profiling") {
+        backend.Step(STEP);
+        REQUIRE(mjcb_time == nullptr);
+        REQUIRE(backend.stats().collision_time == 0.0);
+        REQUIRE(backend.stats().solver_time == 0.0);
+    }
+
+    SECTION("Pools of mjData share the model of the backend") {
+        constexpr size_t NUM_DATAS = 4;
+        auto pool = backend.CreateDataPool(NUM_DATAS);
+        REQUIRE(pool->size() == NUM_DATAS);
+        REQUIRE(&pool->model() == &backend.mujoco_model());
+        REQUIRE_THROWS(pool->data(NUM_DATAS));
+
+        ::loco::core::ThreadPool thread_pool(2);
+        pool->StepAll(NUM_STEPS, &thread_pool);
+        for (size_t i = 0; i < NUM_DATAS; ++i) {
+            REQUIRE(pool->data(i).time ==
+                    Approx(NUM_STEPS * pool->model().opt.timestep));
+            REQUIRE(pool->data(i).qpos[2] == pool->data(0).qpos[2]);
+        }
+        // The backend's own data isn't touched by the pool
+        REQUIRE(backend.mujoco_data().time == 0.0);
+
+        pool->ResetData(0);
+        REQUIRE(pool->data(0).time == 0.0);
+        REQUIRE(pool->data(0).qpos[2] == Approx(1.0));
+    }
+
+    SECTION("Pools keep the model alive after the backend is gone") {
+        std::unique_ptr<::loco::mujoco::DataPoolMujoco> pool;
+        {
+            SimulationImplMujocoTest other_backend;
+            pool = other_backend.CreateDataPool(1);
+        }
+        pool->StepAll(1);
+        REQUIRE(pool->data(0).time > 0.0);
+    }
+}
+
+#endif  // LOCO_MUJOCO_ENABLED
@@ -0,0 +1,109 @@
+#include <catch2/catch.hpp>
+#include <loco/core/thread_pool_t.hpp>
+#include <loco/core/simulation_batch_t.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// NOLINTNEXTLINE
+TEST_CASE("ThreadPool type", "[ThreadPool]") {
+    constexpr size_t NUM_WORKERS = 4;
+    constexpr size_t NUM_JOBS = 1000;
+
+    ::loco::core::ThreadPool pool(NUM_WORKERS);
+    REQUIRE(pool.num_workers() == NUM_WORKERS);
+    REQUIRE_FALSE(pool.pinned());
+
+    SECTION("ParallelFor runs every job exactly once") {
+        std::vector<std::atomic<size_t>> counts(NUM_JOBS);
+        pool.ParallelFor(NUM_JOBS, [&](size_t i) { counts[i].fetch_add(1); });
+        for (size_t i = 0; i < NUM_JOBS; ++i) {
+            REQUIRE(counts[i].load() == 1);
+        }
+    }
+
+    SECTION("Nested ParallelFor calls don't deadlock") {
+        std::atomic<size_t> total{0};
+        pool.ParallelFor(NUM_WORKERS * 2, [&](size_t) {
+            pool.ParallelFor(NUM_WORKERS, [&](size_t) { total.fetch_add(1); });
+        });
+        REQUIRE(total.load() == NUM_WORKERS * NUM_WORKERS * 2);
+    }
+
+    SECTION("Submitted tasks are all executed before WaitIdle returns") {
+        std::atomic<size_t> total{0};
+        for (size_t i = 0; i < NUM_JOBS; ++i) {
+            pool.Submit([&]() { total.fetch_add(1); });
+        }
+        pool.WaitIdle();
+        REQUIRE(total.load() == NUM_JOBS);
+    }
+
+    SECTION("WaitIdle runs tasks submitted while it's waiting") {
+        // A single worker stays busy until a task submitted later (from
+        // another thread) runs, so only the waiting thread can run that task
+        ::loco::core::ThreadPool single_pool(1);
+        std::atomic<bool> released{false};
+        single_pool.Submit([&]() {
+            while (!released.load()) {
+                std::this_thread::yield();
+            }
+        });
+        std::thread submitter([&]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            single_pool.Submit([&]() { released.store(true); });
+        });
+        single_pool.WaitIdle();
+        submitter.join();
+        REQUIRE(released.load());
+    }
+
+    SECTION("WaitIdle can't be called from within a task of the pool") {
+        std::atomic<bool> threw{false};
+        pool.Submit([&]() {
+            try {
+                pool.WaitIdle();
+            } catch (const std::runtime_error&) {
+                threw.store(true);
+            }
+        });
+        pool.WaitIdle();
+        REQUIRE(threw.load());
+    }
+
+    SECTION("Pinned workers run jobs on the allowed cores") {
+        ::loco::core::ThreadPool pinned_pool(NUM_WORKERS, true);
+        REQUIRE(pinned_pool.pinned());
+        std::atomic<size_t> total{0};
+        pinned_pool.ParallelFor(NUM_JOBS, [&](size_t) { total.fetch_add(1); });
+        REQUIRE(total.load() == NUM_JOBS);
+    }
+
+    SECTION("Exceptions thrown by jobs are forwarded to the caller") {
+        REQUIRE_THROWS_AS(pool.ParallelFor(NUM_JOBS,
+                                           [](size_t i) {
+                                               if (i == NUM_JOBS / 2) {
+                                                   throw std::runtime_error(
+                                                       "job failed");
+                                               }
+                                           }),
+                          std::runtime_error);
+    }
+
+    SECTION("SimulationBatch can dispatch its simulations to the pool") {
+        auto shared_pool =
+            std::make_shared<::loco::core::ThreadPool>(NUM_WORKERS);
+        ::loco::core::SimulationBatch batch(
+            NUM_JOBS,
+            [](size_t) { return std::make_shared<::loco::core::Scenario>(); },
+            ::loco::eBackendType::NONE);
+        batch.SetThreadPool(shared_pool);
+        REQUIRE(batch.thread_pool() == shared_pool);
+        batch.Init();
+        REQUIRE_NOTHROW(batch.StepAll(ToScalar(0.01)));
+        REQUIRE_NOTHROW(batch.ResetAll());
+    }
+}
@@ -0,0 +1,126 @@
+#include <catch2/catch.hpp>
+#include <loco/core/trace_session_t.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+// NOLINTNEXTLINE
+TEST_CASE("TraceSession type", "[TraceSession]") {
+    using ::loco::core::TraceScope;
+    using ::loco::core::TraceSession;
+
+    SECTION("Scopes aren't recorded without an active session") {
+        TraceSession::Begin();
+        TraceSession::End();
+        REQUIRE_FALSE(TraceSession::IsActive());
+        { TraceScope scope("inactive_scope"); }
+        REQUIRE(TraceSession::Collect().empty());
+    }
+
+    SECTION("Scopes of all threads are recorded during a session") {
+        constexpr size_t NUM_THREADS = 4;
+        constexpr size_t NUM_SCOPES = 100;
+
+        TraceSession::Begin();
+        REQUIRE(TraceSession::IsActive());
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < NUM_THREADS; ++t) {
+            threads.emplace_back([]() {
+                for (size_t i = 0; i < NUM_SCOPES; ++i) {
+                    TraceScope scope("worker_scope", "test");
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        { TraceScope scope("main_scope"); }
+        TraceSession::End();
+
+        const auto events = TraceSession::Collect();
+        REQUIRE(events.size() == NUM_THREADS * NUM_SCOPES + 1);
+        for (size_t i = 1; i < events.size(); ++i) {
+            REQUIRE(events[i - 1].start_ns <= events[i].start_ns);
+            REQUIRE(events[i].duration_ns >= 0);
+        }
+
+        const auto json = TraceSession::ToChromeTrace();
+        REQUIRE(json.find("\"traceEvents\"") != std::string::npos);
+        REQUIRE(json.find("\"name\":\"worker_scope\"") != std::string::npos);
+        REQUIRE(json.find("\"cat\":\"test\"") != std::string::npos);
+        REQUIRE(json.find("\"name\":\"main_scope\"") != std::string::npos);
+    }
+
+    SECTION("Ring buffers keep only the latest events of each thread") {
+        TraceSession::Begin();
+        std::thread thread([]() {
+            for (size_t i = 0; i < 2 * TraceSession::BUFFER_CAPACITY; ++i) {
+                TraceScope scope("ring_scope");
+            }
+        });
+        thread.join();
+        TraceSession::End();
+
+        REQUIRE(TraceSession::Collect().size() ==
+                TraceSession::BUFFER_CAPACITY);
+    }
+
+    SECTION("A new session discards the events of the previous one") {
+        TraceSession::Begin();
+        { TraceScope scope("old_scope"); }
+        TraceSession::End();
+        TraceSession::Begin();
+        { TraceScope scope("new_scope"); }
+        TraceSession::End();
+
+        const auto events = TraceSession::Collect();
+        REQUIRE(events.size() == 1);
+        REQUIRE(std::string(events[0].name) == "new_scope");
+    }
+
+    SECTION("Events of previous sessions are discarded by their position") {
+        // E.g. scopes entered in the previous session but exited in this one
+        TraceSession::Begin();
+        const auto LATER = TraceSession::Now() + 1000000000;
+        TraceSession::Record("old_scope", "test", LATER, LATER + 1);
+        TraceSession::End();
+        TraceSession::Begin();
+        TraceSession::End();
+        REQUIRE(TraceSession::Collect().empty());
+    }
+
+    SECTION("Reused buffers record the index of their new thread") {
+        TraceSession::Begin();
+        std::thread first([]() { TraceScope scope("first_scope"); });
+        first.join();
+        std::thread second([]() { TraceScope scope("second_scope"); });
+        second.join();
+        TraceSession::End();
+
+        const auto events = TraceSession::Collect();
+        REQUIRE(events.size() == 2);
+        REQUIRE(events[0].thread_index != events[1].thread_index);
+    }
+
+    SECTION("Events are collected consistently while being recorded") {
+        TraceSession::Begin();
+        std::atomic<bool> done{false};
+        std::thread writer([&done]() {
+            for (size_t i = 0; i < 4 * TraceSession::BUFFER_CAPACITY; ++i) {
+                TraceScope scope("concurrent_scope");
+            }
+            done.store(true);
+        });
+        while (!done.load()) {
+            for (const auto& event : TraceSession::Collect()) {
+                REQUIRE(event.name != nullptr);
+                REQUIRE(std::string(event.name) == "concurrent_scope");
+                REQUIRE(event.duration_ns >= 0);
+            }
+        }
+        writer.join();
+        TraceSession::End();
+    }
+}
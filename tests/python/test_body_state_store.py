@@ -0,0 +1,63 @@
+import pytest
+
+import numpy as np
+
+import loco
+
+
+def create_body(position: np.ndarray) -> loco.SingleBody:
+    return loco.SingleBody(loco.BodyData(), position.astype(np.float32))
+
+
+class TestBodyStateStore:
+    def test_views_alias_the_store(self) -> None:
+        scenario = loco.Scenario()
+        body_a = create_body(np.array([1.0, 0.0, 0.0]))
+        body_b = create_body(np.array([0.0, 2.0, 0.0]))
+        scenario.AddSingleBody(body_a)
+        scenario.AddSingleBody(body_b)
+
+        states = scenario.body_states
+        assert states.size == 2
+        assert states.num_bodies == 2
+        positions = states.positions
+        assert positions.shape == (2, 3)
+        assert np.allclose(positions, [[1.0, 0.0, 0.0], [0.0, 2.0, 0.0]])
+        assert states.orientations.shape == (2, 4)
+        assert np.allclose(states.orientations[:, 0], 1.0)
+
+        # Writes through the views are seen by the bodies, and vice versa
+        positions[1] = [0.0, 0.0, 5.0]
+        assert np.abs(body_b.position().z - 5.0) < 1e-6
+        body_a.SetPosition(np.array([0.0, 0.0, 7.0], dtype=np.float32))
+        assert np.abs(positions[0, 2] - 7.0) < 1e-6
+        states.forces[0] = [1.0, 2.0, 3.0]
+        assert np.abs(body_a.totalForceCOM.y - 2.0) < 1e-6
+
+    def test_views_stay_valid_after_adding_bodies(self) -> None:
+        scenario = loco.Scenario()
+        scenario.AddSingleBody(create_body(np.array([1.0, 2.0, 3.0])))
+        positions = scenario.body_states.positions
+        for i in range(100):
+            scenario.AddSingleBody(create_body(np.array([float(i), 0.0, 0.0])))
+
+        # The old view still aliases the (unmoved) storage of the first body
+        positions[0, 0] = 4.0
+        new_positions = scenario.body_states.positions
+        assert new_positions.shape == (101, 3)
+        assert np.abs(new_positions[0, 0] - 4.0) < 1e-6
+        assert np.allclose(new_positions[100], [99.0, 0.0, 0.0])
+
+    def test_views_keep_the_store_alive(self) -> None:
+        scenario = loco.Scenario()
+        scenario.AddSingleBody(create_body(np.array([1.0, 2.0, 3.0])))
+        positions = scenario.body_states.positions
+        del scenario
+        assert np.allclose(positions[0], [1.0, 2.0, 3.0])
+
+    def test_full_stores_raise(self) -> None:
+        scenario = loco.Scenario(max_single_bodies=1)
+        scenario.AddSingleBody(create_body(np.array([0.0, 0.0, 0.0])))
+        with pytest.raises(RuntimeError):
+            scenario.AddSingleBody(create_body(np.array([0.0, 0.0, 0.0])))
+        assert scenario.num_single_bodies == 1
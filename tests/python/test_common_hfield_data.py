@@ -37,3 +37,20 @@ class TestHeightfield:
         assert hfield_data.n_depth_samples == 10
         assert hfield_data.heights.shape == (10, 10)
         assert np.allclose(hfield_data.heights, array_np)
+
+    def test_views_dont_leak_into_copies(self) -> None:
+        hfield_data = loco.HeightfieldData()
+        array_np = np.random.randn(10, 10).astype(np.float32)
+        hfield_data.heights = array_np
+        view = hfield_data.heights
+
+        collider_data = loco.ColliderData()
+        collider_data.hfield_data = hfield_data
+        with pytest.raises(ValueError):
+            view[:] = 0.0
+
+        new_heights = view.copy()
+        new_heights[:] = 0.0
+        hfield_data.heights = new_heights
+        assert np.allclose(hfield_data.heights, 0.0)
+        assert np.allclose(collider_data.hfield_data.heights, array_np)
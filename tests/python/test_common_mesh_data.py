@@ -34,3 +34,22 @@ class TestMeshData:
         assert mesh_data.n_faces == 4
         assert mesh_data.faces.shape == (12,)
         assert np.allclose(mesh_data.faces, faces.flatten())
+
+    def test_views_dont_leak_into_copies(self) -> None:
+        mesh_data = loco.MeshData()
+        vertices = np.random.randn(10, 3).astype(np.float32)
+        mesh_data.vertices = vertices
+        view = mesh_data.vertices
+
+        # The collider's copy shares the buffer with mesh_data
+        collider_data = loco.ColliderData()
+        collider_data.mesh_data = mesh_data
+        with pytest.raises(ValueError):
+            view[:] = 0.0
+
+        # Changes go through the setter, which gives mesh_data its own buffer
+        new_vertices = view.copy()
+        new_vertices[:] = 0.0
+        mesh_data.vertices = new_vertices
+        assert np.allclose(mesh_data.vertices, 0.0)
+        assert np.allclose(collider_data.mesh_data.vertices, vertices.flatten())
@@ -0,0 +1,42 @@
+import pytest
+
+import numpy as np
+
+import loco
+
+SQUARE_OBJ = """v 0.0 0.0 0.0
+v 1.0 0.0 0.0
+v 1.0 1.0 0.0
+v 0.0 1.0 0.0
+f 1 2 3 4
+"""
+
+
+class TestMeshLoader:
+    def test_load_through_cache(self, tmp_path) -> None:
+        filepath = str(tmp_path / "square.obj")
+        with open(filepath, "w") as file:
+            file.write(SQUARE_OBJ)
+        cache_directory = str(tmp_path / "caches")
+        loco.MeshLoader.SetCacheDirectory(cache_directory)
+        try:
+            assert loco.MeshLoader.GetCacheDirectory() == cache_directory
+            cache_path = loco.MeshLoader.GetCachePath(filepath)
+            assert cache_path.startswith(cache_directory)
+            assert cache_path.endswith(loco.MeshLoader.CACHE_EXTENSION)
+
+            parsed = loco.MeshLoader.Load(filepath)
+            cached = loco.MeshLoader.Load(filepath)
+            assert (tmp_path / "caches").is_dir()
+            for mesh_data in [parsed, cached]:
+                assert mesh_data.filepath == filepath
+                assert mesh_data.n_vertices == 4
+                assert mesh_data.n_faces == 2
+            assert np.allclose(parsed.vertices, cached.vertices)
+            assert np.array_equal(parsed.faces, cached.faces)
+        finally:
+            loco.MeshLoader.SetCacheDirectory("")
+
+    def test_unsupported_formats_throw(self) -> None:
+        with pytest.raises(RuntimeError):
+            loco.MeshLoader.Parse("mesh.ply")
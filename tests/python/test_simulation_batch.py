@@ -0,0 +1,77 @@
+import threading
+
+import numpy as np
+
+import loco
+
+NUM_ENVS = 8
+NUM_STEPS = 200
+TIMESTEP = 0.01
+
+
+def create_batch(num_envs: int) -> loco.SimulationBatch:
+    batch = loco.SimulationBatch(
+        num_envs, lambda env_index: loco.Scenario(), loco.BackendType.NONE
+    )
+    batch.SetThreadPool(loco.ThreadPool(2))
+    batch.Init()
+    return batch
+
+
+class TestSimulationBatch:
+    def test_step_from_background_thread(self) -> None:
+        batch = create_batch(NUM_ENVS)
+        finished = threading.Event()
+
+        def step_batch() -> None:
+            for _ in range(NUM_STEPS):
+                batch.StepAll(TIMESTEP)
+            finished.set()
+
+        # StepAll releases the GIL, so this thread keeps running Python code
+        # while the other one is stepping the batch
+        thread = threading.Thread(target=step_batch)
+        thread.start()
+        num_iterations = 0
+        while not finished.is_set():
+            num_iterations += 1
+        thread.join(timeout=30.0)
+
+        assert not thread.is_alive()
+        assert num_iterations > 0
+        for env_index in range(NUM_ENVS):
+            stats = batch.simulation(env_index).stats
+            assert stats.num_steps == NUM_STEPS
+
+    def test_step_batches_from_many_threads(self) -> None:
+        batches = [create_batch(NUM_ENVS) for _ in range(4)]
+        threads = [
+            threading.Thread(
+                target=lambda batch=batch: [
+                    batch.StepAll(TIMESTEP) for _ in range(NUM_STEPS)
+                ]
+            )
+            for batch in batches
+        ]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join(timeout=30.0)
+            assert not thread.is_alive()
+        for batch in batches:
+            assert batch.simulation(0).stats.num_steps == NUM_STEPS
+
+    def test_observation_fn_writes_into_rows(self) -> None:
+        batch = create_batch(NUM_ENVS)
+
+        def observe(env_index, simulation, observation) -> None:
+            assert observation.shape == (3,)
+            observation[:] = [env_index, simulation.stats.num_steps, 1.0]
+
+        batch.SetObservationFn(3, observe)
+        observations = batch.observations
+        batch.StepAll(TIMESTEP)
+        batch.CollectObservations()
+
+        for env_index in range(NUM_ENVS):
+            assert np.allclose(observations[env_index], [env_index, 1.0, 1.0])